@@ -0,0 +1,31 @@
+//===-- addoi3.c - Implement __addoi3 -------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __addoi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_oi.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: a + b + carry_in
+// Effects: if carry_out != 0, *carry_out = carry out of the 256 bit sum
+// carry_in must be 0 or 1.
+
+COMPILER_RT_ABI ou_int __addoi3(ou_int a, ou_int b, su_int carry_in,
+                                su_int *carry_out) {
+  su_int carry;
+  const ou_int r = ou_add(a, b, carry_in, &carry);
+  if (carry_out)
+    *carry_out = carry;
+  return r;
+}
+
+#endif // CRT_HAS_128BIT
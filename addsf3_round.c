@@ -0,0 +1,56 @@
+//===-- lib/addsf3_round.c - Single-precision directed addition ---*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements single-precision soft-float addition and subtraction
+// rounded toward zero, downward and upward, whatever the current mode, and
+// rounded both downward and upward by a single call for interval arithmetic.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define SINGLE_PRECISION
+#include "fp_add_impl.inc"
+
+COMPILER_RT_ABI fp_t __addsf3_rz(fp_t a, fp_t b) {
+  return __addXf3_round__(a, b, CRT_FE_TOWARDZERO);
+}
+
+COMPILER_RT_ABI fp_t __addsf3_rd(fp_t a, fp_t b) {
+  return __addXf3_round__(a, b, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI fp_t __addsf3_ru(fp_t a, fp_t b) {
+  return __addXf3_round__(a, b, CRT_FE_UPWARD);
+}
+
+// Subtraction; flip the sign bit of b and add.
+
+COMPILER_RT_ABI fp_t __subsf3_rz(fp_t a, fp_t b) {
+  return __addsf3_rz(a, fromRep(toRep(b) ^ signBit));
+}
+
+COMPILER_RT_ABI fp_t __subsf3_rd(fp_t a, fp_t b) {
+  return __addsf3_rd(a, fromRep(toRep(b) ^ signBit));
+}
+
+COMPILER_RT_ABI fp_t __subsf3_ru(fp_t a, fp_t b) {
+  return __addsf3_ru(a, fromRep(toRep(b) ^ signBit));
+}
+
+// Both bounds at once, from a single sum.
+
+COMPILER_RT_ABI void __addsf3_bounds(fp_t a, fp_t b, fp_t *lo, fp_t *hi) {
+  __addXf3_bounds__(a, b, lo, hi);
+}
+
+COMPILER_RT_ABI void __subsf3_bounds(fp_t a, fp_t b, fp_t *lo, fp_t *hi) {
+  __addXf3_bounds__(a, fromRep(toRep(b) ^ signBit), lo, hi);
+}
+
+#endif
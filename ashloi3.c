@@ -0,0 +1,26 @@
+//===-- ashloi3.c - Implement __ashloi3 -----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __ashloi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_oi.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: a << b
+
+// Precondition:  0 <= b < bits_in_oword
+
+COMPILER_RT_ABI oi_int __ashloi3(oi_int a, int b) {
+  return ou_to_oi(ou_shl(oi_to_ou(a), b));
+}
+
+#endif // CRT_HAS_128BIT
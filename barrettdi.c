@@ -0,0 +1,91 @@
+//===-- barrettdi.c - Implement reciprocal-based mulmod -------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements multiplication modulo an arbitrary 64 bit modulus by
+// a precomputed reciprocal for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+// Reduction uses the reciprocal-based 128-by-64 bit division from
+// int_udiv128.h with a reciprocal computed once per modulus, so a product is
+// reduced with a few multiplies instead of a __umodti3 call.
+
+// Returns: (high * 2^64 + low) mod ctx->modulus
+// Precondition:  high < modulus
+static __inline du_int reduce(du_int high, du_int low, const du_barrett *ctx) {
+  const unsigned bits_in_dword = sizeof(du_int) * CHAR_BIT;
+  const unsigned shift = ctx->shift;
+  du_int r;
+  if (shift == 0) {
+    udiv128by64to64preinv(high, low, ctx->normalized, ctx->reciprocal, &r);
+    return r;
+  }
+  // The remainder of the scaled dividend is scaled by the same 2^shift.
+  high = (high << shift) | (low >> (bits_in_dword - shift));
+  udiv128by64to64preinv(high, low << shift, ctx->normalized, ctx->reciprocal,
+                        &r);
+  return r >> shift;
+}
+
+// Returns: a * b mod ctx->modulus
+// Precondition:  a < modulus
+static __inline du_int mulmod(du_int a, du_int b, const du_barrett *ctx) {
+  du_int low;
+  const du_int high = umul64x64to128(a, b, &low);
+  return reduce(high, low, ctx);
+}
+
+// Effects: prepares *ctx for arithmetic modulo m
+// m == 0 cases are undefined.
+
+COMPILER_RT_ABI void __barrettdi_init(du_barrett *ctx, du_int m) {
+  const unsigned shift = __builtin_clzll(m);
+  ctx->modulus = m;
+  ctx->normalized = m << shift;
+  ctx->reciprocal = reciprocal_word(m << shift);
+  ctx->shift = shift;
+}
+
+// Returns: a * b mod m
+// Precondition:  a < m
+
+COMPILER_RT_ABI du_int __barrettmuldi3(du_int a, du_int b,
+                                       const du_barrett *ctx) {
+  return mulmod(a, b, ctx);
+}
+
+// Effects: r[i] = a[i] * b[i] mod m for i < n
+// Precondition:  a[i] < m
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __barrettmuldi3_n(du_int *r, const du_int *a,
+                                       const du_int *b, size_t n,
+                                       const du_barrett *ctx) {
+  const du_barrett c = *ctx;
+  for (size_t i = 0; i < n; ++i)
+    r[i] = mulmod(a[i], b[i], &c);
+}
+
+// Returns: a^e mod m
+
+COMPILER_RT_ABI du_int __barrettpowdi3(du_int a, du_int e,
+                                       const du_barrett *ctx) {
+  const du_barrett c = *ctx;
+  const du_int x = reduce(0, a, &c);
+  du_int result = reduce(0, 1, &c);
+  // Left to right square and multiply.
+  for (int i = e ? 63 - __builtin_clzll(e) : -1; i >= 0; --i) {
+    result = mulmod(result, result, &c);
+    if ((e >> i) & 1)
+      result = mulmod(result, x, &c);
+  }
+  return result;
+}
@@ -0,0 +1,194 @@
+//===-- bitmapdi.c - Implement __crt_bitmap_find_first_set and friends ----===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements bitmap scans over arrays of 64 bit words for the
+// compiler_rt library: the first set or clear bit, the next one from an
+// index and the first run of clear bits of a given length. Runs of all-clear
+// or all-set words are skipped 32 or 64 bytes at a time.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+
+// Bit i of a bitmap is bit i % 64 of word i / 64. A bitmap of nbits bits
+// spans (nbits + 63) / 64 words; bits past nbits in the last word are
+// ignored.
+
+#define BITS_PER_WORD ((size_t)(sizeof(du_int) * CHAR_BIT))
+
+// The bit positions within a word come from __builtin_ctzll and
+// __builtin_clzll, which are single instructions where the target has them
+// and calls to __ctzdi2 and __clzdi2 where it does not.
+
+#ifdef CRT_HAS_X86_VECTOR
+
+typedef du_int v4du __attribute__((__vector_size__(32)));
+typedef long long v4di __attribute__((__vector_size__(32)));
+
+#define AVX2 __attribute__((__target__("avx2")))
+
+static __inline AVX2 v4du load_avx2(const du_int *p) {
+  v4du v;
+  __builtin_memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// Returns: the index of the first block of 8 words from i on holding a word
+// other than skip, or the start of the last partial block.
+static AVX2 size_t skip_words_avx2(const du_int *a, size_t i, size_t n,
+                                   du_int skip) {
+  const v4du s = (v4du){} + skip;
+  for (; n - i >= 8; i += 8) {
+    const v4di x = (v4di)((load_avx2(a + i) ^ s) | (load_avx2(a + i + 4) ^ s));
+    if (!__builtin_ia32_ptestz256(x, x))
+      break;
+  }
+  return i;
+}
+
+#endif // CRT_HAS_X86_VECTOR
+
+#ifdef __SSE2__
+
+typedef du_int v2du __attribute__((__vector_size__(16)));
+typedef char v16qi __attribute__((__vector_size__(16)));
+
+// Returns: the index of the first block of 4 words from i on holding a word
+// other than skip, or the start of the last partial block.
+static size_t skip_words_sse2(const du_int *a, size_t i, size_t n,
+                              du_int skip) {
+  const v2du s = (v2du){} + skip;
+  for (; n - i >= 4; i += 4) {
+    v2du x, y;
+    __builtin_memcpy(&x, a + i, sizeof(x));
+    __builtin_memcpy(&y, a + i + 2, sizeof(y));
+    // SSE2 has no ptest; every byte compares equal to zero iff all of the
+    // 32 bytes are skip.
+    const v16qi z = (v16qi)((x ^ s) | (y ^ s)) == (v16qi){};
+    if (__builtin_ia32_pmovmskb128(z) != 0xFFFF)
+      break;
+  }
+  return i;
+}
+
+#endif // __SSE2__
+
+// Returns: the index of the first word in a[i .. n) other than skip, or n.
+// skip is 0 to look for a set bit and ~0 to look for a clear one.
+static size_t skip_words(const du_int *a, size_t i, size_t n, du_int skip) {
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2)
+    i = skip_words_avx2(a, i, n, skip);
+#endif
+#ifdef __SSE2__
+  i = skip_words_sse2(a, i, n, skip);
+#endif
+  while (i < n && a[i] == skip)
+    ++i;
+  return i;
+}
+
+// Returns: the index of the first bit at or after start that differs from
+// the bits of skip, or nbits.
+static size_t find_next(const du_int *a, size_t nbits, size_t start,
+                        du_int skip) {
+  if (start >= nbits)
+    return nbits;
+  const size_t n = (nbits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+  size_t i = start / BITS_PER_WORD;
+  // Bits below start in its word must not be found.
+  du_int w = (a[i] ^ skip) & (~(du_int)0 << (start % BITS_PER_WORD));
+  if (w == 0) {
+    i = skip_words(a, i + 1, n, skip);
+    if (i == n)
+      return nbits;
+    w = a[i] ^ skip;
+  }
+  const size_t r = i * BITS_PER_WORD + (size_t)__builtin_ctzll(w);
+  return r < nbits ? r : nbits;
+}
+
+// Returns: the index of the first set bit in the bitmap, or nbits
+
+COMPILER_RT_ABI size_t __crt_bitmap_find_first_set(const du_int *a,
+                                                   size_t nbits) {
+  return find_next(a, nbits, 0, 0);
+}
+
+// Returns: the index of the first clear bit in the bitmap, or nbits
+
+COMPILER_RT_ABI size_t __crt_bitmap_find_first_clear(const du_int *a,
+                                                     size_t nbits) {
+  return find_next(a, nbits, 0, ~(du_int)0);
+}
+
+// Returns: the index of the first set bit at or after start, or nbits
+
+COMPILER_RT_ABI size_t __crt_bitmap_find_next_set(const du_int *a,
+                                                  size_t nbits, size_t start) {
+  return find_next(a, nbits, start, 0);
+}
+
+// Returns: the index of the first clear bit at or after start, or nbits
+
+COMPILER_RT_ABI size_t __crt_bitmap_find_next_clear(const du_int *a,
+                                                    size_t nbits,
+                                                    size_t start) {
+  return find_next(a, nbits, start, ~(du_int)0);
+}
+
+// Returns: the index of the first run of len clear bits, or nbits
+// len == 0 finds the run at 0.
+
+COMPILER_RT_ABI size_t __crt_bitmap_find_clear_run(const du_int *a,
+                                                   size_t nbits, size_t len) {
+  if (len == 0)
+    return 0;
+  const size_t n = (nbits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+  // run counts the clear bits at the top of the words before word i.
+  size_t run = 0;
+  for (size_t i = 0; i < n; ++i) {
+    du_int w = a[i];
+    // Bits past nbits count as set.
+    if (i == n - 1 && nbits % BITS_PER_WORD)
+      w |= ~(du_int)0 << (nbits % BITS_PER_WORD);
+    if (w == ~(du_int)0) {
+      // Neither ends nor starts a run. Stretches of more than four full
+      // words go to skip_words; shorter ones are not worth the call.
+      run = 0;
+      if (i + 4 < n &&
+          (a[i + 1] & a[i + 2] & a[i + 3] & a[i + 4]) == ~(du_int)0)
+        i = skip_words(a, i + 5, n, ~(du_int)0) - 1;
+      continue;
+    }
+    if (w == 0) {
+      run += BITS_PER_WORD;
+      if (run >= len)
+        return (i + 1) * BITS_PER_WORD - run;
+      continue;
+    }
+    // The run from the previous words ends at the lowest set bit.
+    if (run + (size_t)__builtin_ctzll(w) >= len)
+      return i * BITS_PER_WORD - run;
+    // A shorter run may lie within the word: after the loop, bit p of x is
+    // set iff bits p .. p + len - 1 of the word are all clear.
+    if (len < BITS_PER_WORD) {
+      du_int x = ~w;
+      for (size_t k = 1; k < len;) {
+        const size_t shift = k < len - k ? k : len - k;
+        x &= x >> shift;
+        k += shift;
+      }
+      if (x != 0)
+        return i * BITS_PER_WORD + (size_t)__builtin_ctzll(x);
+    }
+    run = (size_t)__builtin_clzll(w);
+  }
+  return nbits;
+}
@@ -0,0 +1,30 @@
+//===-- bitreversedi2.c - Implement __bitreversedi2 -----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __bitreversedi2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_math.h"
+
+// Returns: a with its bit order reversed
+
+COMPILER_RT_ABI du_int __bitreversedi2(du_int a) {
+#if __has_builtin(__builtin_bitreverse64)
+  // A single instruction where the target has one (rbit on ARM).
+  return __builtin_bitreverse64(a);
+#else
+  // Reverse the bytes, then the nibbles, bit pairs and bits within them.
+  a = __builtin_bswap64(a);
+  a = ((a >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((a & 0x0F0F0F0F0F0F0F0FULL) << 4);
+  a = ((a >> 2) & 0x3333333333333333ULL) | ((a & 0x3333333333333333ULL) << 2);
+  return ((a >> 1) & 0x5555555555555555ULL) |
+         ((a & 0x5555555555555555ULL) << 1);
+#endif
+}
@@ -0,0 +1,29 @@
+//===-- bitreversesi2.c - Implement __bitreversesi2 -----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __bitreversesi2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_math.h"
+
+// Returns: a with its bit order reversed
+
+COMPILER_RT_ABI su_int __bitreversesi2(su_int a) {
+#if __has_builtin(__builtin_bitreverse32)
+  // A single instruction where the target has one (rbit on ARM).
+  return __builtin_bitreverse32(a);
+#else
+  // Reverse the bytes, then the nibbles, bit pairs and bits within them.
+  a = __builtin_bswap32(a);
+  a = ((a >> 4) & 0x0F0F0F0FU) | ((a & 0x0F0F0F0FU) << 4);
+  a = ((a >> 2) & 0x33333333U) | ((a & 0x33333333U) << 2);
+  return ((a >> 1) & 0x55555555U) | ((a & 0x55555555U) << 1);
+#endif
+}
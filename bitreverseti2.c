@@ -0,0 +1,28 @@
+//===-- bitreverseti2.c - Implement __bitreverseti2 -----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __bitreverseti2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: a with its bit order reversed
+
+COMPILER_RT_ABI tu_int __bitreverseti2(tu_int a) {
+  utwords x;
+  x.all = a;
+  utwords r;
+  r.s.low = __bitreversedi2(x.s.high);
+  r.s.high = __bitreversedi2(x.s.low);
+  return r.all;
+}
+
+#endif // CRT_HAS_128BIT
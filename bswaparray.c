@@ -0,0 +1,180 @@
+//===-- bswaparray.c - Implement __bswapsi2_n and friends -----------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements byte swapping over arrays of 16, 32, 64 and 128 bit
+// elements for the compiler_rt library, for converting buffers between big
+// and little endian. On x86 the elements are swapped 16 or 32 bytes at a
+// time with pshufb.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+
+// The scalar loops use the compiler's bswap builtins. They become a single
+// instruction where the target has one and a call to __bswapsi2 or
+// __bswapdi2 elsewhere.
+
+#ifdef CRT_HAS_X86_VECTOR
+
+typedef char v16qi __attribute__((__vector_size__(16)));
+typedef char v32qi __attribute__((__vector_size__(32)));
+
+#define AVX2 __attribute__((__target__("avx2")))
+#define SSSE3 __attribute__((__target__("ssse3")))
+
+// Byte j of a size-byte element moves to byte size - 1 - j, which for a
+// power of two size is index ^ (size - 1). pshufb only looks at the low four
+// bits of each index, within each 16 byte lane.
+#define REVERSE_MASK_16                                                        \
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}
+#define REVERSE_MASK_32                                                        \
+  {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,                       \
+   0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}
+
+// Effects: reverses every size-byte element of the bytes bytes at src into
+// dst, bytes a multiple of 16.
+static __inline ALWAYS_INLINE AVX2 void
+bswap_avx2_kernel(char *dst, const char *src, size_t bytes, int size) {
+  const v32qi mask = (v32qi)REVERSE_MASK_32 ^ (char)(size - 1);
+  size_t i = 0;
+  for (; i + 64 <= bytes; i += 64) {
+    v32qi x, y;
+    __builtin_memcpy(&x, src + i, sizeof(x));
+    __builtin_memcpy(&y, src + i + 32, sizeof(y));
+    x = __builtin_ia32_pshufb256(x, mask);
+    y = __builtin_ia32_pshufb256(y, mask);
+    __builtin_memcpy(dst + i, &x, sizeof(x));
+    __builtin_memcpy(dst + i + 32, &y, sizeof(y));
+  }
+  for (; i < bytes; i += 16) {
+    v16qi x;
+    __builtin_memcpy(&x, src + i, sizeof(x));
+    x = __builtin_ia32_pshufb128(x, (v16qi)REVERSE_MASK_16 ^ (char)(size - 1));
+    __builtin_memcpy(dst + i, &x, sizeof(x));
+  }
+}
+
+static __inline ALWAYS_INLINE SSSE3 void
+bswap_ssse3_kernel(char *dst, const char *src, size_t bytes, int size) {
+  const v16qi mask = (v16qi)REVERSE_MASK_16 ^ (char)(size - 1);
+  size_t i = 0;
+  for (; i + 32 <= bytes; i += 32) {
+    v16qi x, y;
+    __builtin_memcpy(&x, src + i, sizeof(x));
+    __builtin_memcpy(&y, src + i + 16, sizeof(y));
+    x = __builtin_ia32_pshufb128(x, mask);
+    y = __builtin_ia32_pshufb128(y, mask);
+    __builtin_memcpy(dst + i, &x, sizeof(x));
+    __builtin_memcpy(dst + i + 16, &y, sizeof(y));
+  }
+  if (i < bytes) {
+    v16qi x;
+    __builtin_memcpy(&x, src + i, sizeof(x));
+    x = __builtin_ia32_pshufb128(x, mask);
+    __builtin_memcpy(dst + i, &x, sizeof(x));
+  }
+}
+
+// The kernels are inlined here with a constant size so that the mask is a
+// constant; they cannot be inlined into the callers, which are not compiled
+// for AVX2 or SSSE3.
+static AVX2 void bswap_avx2(char *dst, const char *src, size_t bytes,
+                            int size) {
+  switch (size) {
+  case 2:
+    bswap_avx2_kernel(dst, src, bytes, 2);
+    break;
+  case 4:
+    bswap_avx2_kernel(dst, src, bytes, 4);
+    break;
+  case 8:
+    bswap_avx2_kernel(dst, src, bytes, 8);
+    break;
+  default:
+    bswap_avx2_kernel(dst, src, bytes, 16);
+    break;
+  }
+}
+
+static SSSE3 void bswap_ssse3(char *dst, const char *src, size_t bytes,
+                              int size) {
+  switch (size) {
+  case 2:
+    bswap_ssse3_kernel(dst, src, bytes, 2);
+    break;
+  case 4:
+    bswap_ssse3_kernel(dst, src, bytes, 4);
+    break;
+  case 8:
+    bswap_ssse3_kernel(dst, src, bytes, 8);
+    break;
+  default:
+    bswap_ssse3_kernel(dst, src, bytes, 16);
+    break;
+  }
+}
+
+#endif // CRT_HAS_X86_VECTOR
+
+// Effects: reverses the size-byte elements at the front of src into dst,
+// using pshufb where the processor has it.
+// Returns: the number of elements done; the caller swaps the rest.
+static size_t bswap_vector(void *dst, const void *src, size_t n, int size) {
+#ifdef CRT_HAS_X86_VECTOR
+  const size_t bytes = (n * size) & ~(size_t)15;
+  const su_int features = crt_cpu_features();
+  if (features & CRT_CPU_AVX2) {
+    bswap_avx2((char *)dst, (const char *)src, bytes, size);
+    return bytes / size;
+  }
+  if (features & CRT_CPU_SSSE3) {
+    bswap_ssse3((char *)dst, (const char *)src, bytes, size);
+    return bytes / size;
+  }
+#else
+  (void)dst;
+  (void)src;
+  (void)n;
+  (void)size;
+#endif
+  return 0;
+}
+
+// Effects: dst[i] = the bytes of src[i] in reverse order, for i < n
+// dst may be the same array as src, which swaps the array in place.
+
+COMPILER_RT_ABI void __bswaphi2_n(uint16_t *dst, const uint16_t *src,
+                                  size_t n) {
+  for (size_t i = bswap_vector(dst, src, n, sizeof(*src)); i < n; ++i)
+    dst[i] = __builtin_bswap16(src[i]);
+}
+
+COMPILER_RT_ABI void __bswapsi2_n(uint32_t *dst, const uint32_t *src,
+                                  size_t n) {
+  for (size_t i = bswap_vector(dst, src, n, sizeof(*src)); i < n; ++i)
+    dst[i] = __builtin_bswap32(src[i]);
+}
+
+COMPILER_RT_ABI void __bswapdi2_n(uint64_t *dst, const uint64_t *src,
+                                  size_t n) {
+  for (size_t i = bswap_vector(dst, src, n, sizeof(*src)); i < n; ++i)
+    dst[i] = __builtin_bswap64(src[i]);
+}
+
+#ifdef CRT_HAS_128BIT
+
+COMPILER_RT_ABI void __bswapti2_n(tu_int *dst, const tu_int *src, size_t n) {
+  for (size_t i = bswap_vector(dst, src, n, sizeof(*src)); i < n; ++i) {
+    const tu_int x = src[i];
+    dst[i] = ((tu_int)__builtin_bswap64((du_int)x) << 64) |
+             __builtin_bswap64((du_int)(x >> 64));
+  }
+}
+
+#endif // CRT_HAS_128BIT
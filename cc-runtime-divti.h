@@ -0,0 +1,184 @@
+//===-- cc-runtime-divti.h - Inline 128 bit division ------------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file is part of the interface of this library and may be included by
+// its users.
+//
+// It defines inline 128 bit division and remainder functions. When the
+// divisor is a compile-time constant, the reciprocal it needs is folded by
+// the compiler and the division becomes a few multiplies, as GCC and Clang
+// already do for 32 and 64 bit division; x / 1000000000000000000 no longer
+// calls __udivti3. Other divisors call __udivmodti4.
+//
+// The constant paths need optimization to be enabled; at -O0 every call
+// goes to __udivmodti4.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_DIVTI_H
+#define CC_RUNTIME_DIVTI_H
+
+#ifdef __SIZEOF_INT128__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+__extension__ typedef __int128 __cc_runtime_ti_int;
+__extension__ typedef unsigned __int128 __cc_runtime_tu_int;
+
+__cc_runtime_tu_int __udivmodti4(__cc_runtime_tu_int a, __cc_runtime_tu_int b,
+                                 __cc_runtime_tu_int *rem);
+
+#define CC_RUNTIME_DIVTI_INLINE                                                \
+  static __inline__ __attribute__((__always_inline__, __unused__))
+
+// Returns: floor((2^128 - 1) / d) - 2^64 for a normalized d (d >= 2^63).
+// Only meant to be folded for a constant d.
+CC_RUNTIME_DIVTI_INLINE unsigned long long
+__cc_runtime_reciprocal(unsigned long long d) {
+  return (unsigned long long)(~(__cc_runtime_tu_int)0 / d);
+}
+
+// Returns the 128 bit division result by the normalized 64 bit d, given
+// v = __cc_runtime_reciprocal(d). Result must fit in 64 bits (u1 < d).
+// Remainder stored in r. See N. Moller and T. Granlund, "Improved division
+// by invariant integers", IEEE Transactions on Computers, 2011.
+CC_RUNTIME_DIVTI_INLINE unsigned long long
+__cc_runtime_udiv128by64to64preinv(unsigned long long u1, unsigned long long u0,
+                                   unsigned long long d, unsigned long long v,
+                                   unsigned long long *r) {
+  const __cc_runtime_tu_int p =
+      (__cc_runtime_tu_int)v * u1 + (((__cc_runtime_tu_int)u1 << 64) | u0);
+  unsigned long long q1 = (unsigned long long)(p >> 64) + 1;
+  const unsigned long long q0 = (unsigned long long)p;
+  unsigned long long rem = u0 - q1 * d;
+  if (rem > q0) {
+    q1 -= 1;
+    rem += d;
+  }
+  if (rem >= d) {
+    q1 += 1;
+    rem -= d;
+  }
+  *r = rem;
+  return q1;
+}
+
+// Effects: if rem != 0, *rem = a % b
+// Returns: a / b
+CC_RUNTIME_DIVTI_INLINE __cc_runtime_tu_int
+cc_runtime_udivmodti4(__cc_runtime_tu_int a, __cc_runtime_tu_int b,
+                      __cc_runtime_tu_int *rem) {
+  if (__builtin_constant_p(b) && b != 0) {
+    const unsigned long long a1 = (unsigned long long)(a >> 64);
+    const unsigned long long a0 = (unsigned long long)a;
+    const unsigned long long b1 = (unsigned long long)(b >> 64);
+    const unsigned long long b0 = (unsigned long long)b;
+    if ((b & (b - 1)) == 0) {
+      const int shift = b0 ? __builtin_ctzll(b0) : 64 + __builtin_ctzll(b1);
+      if (rem)
+        *rem = a & (b - 1);
+      return a >> shift;
+    }
+    if (b1 == 0) {
+      // The high word is divided by the compiler's own 64 bit constant
+      // division; the rest by the normalized divisor and its reciprocal.
+      const int shift = __builtin_clzll(b0);
+      const unsigned long long d = b0 << shift;
+      const unsigned long long v = __cc_runtime_reciprocal(d);
+      const unsigned long long q1 = a1 / b0;
+      unsigned long long r = a1 % b0;
+      const unsigned long long n1 =
+          shift ? (r << shift) | (a0 >> (64 - shift)) : r;
+      const unsigned long long q0 =
+          __cc_runtime_udiv128by64to64preinv(n1, a0 << shift, d, v, &r);
+      if (rem)
+        *rem = r >> shift;
+      return ((__cc_runtime_tu_int)q1 << 64) | q0;
+    }
+    // The quotient fits in 64 bits. Estimate it from the top 64 bits of the
+    // normalized divisor; the estimate is either the quotient or one too
+    // large. See Hacker's Delight, 2nd edition, section 9-5.
+    const int shift = __builtin_clzll(b1);
+    const unsigned long long d = (unsigned long long)((b << shift) >> 64);
+    const unsigned long long v = __cc_runtime_reciprocal(d);
+    const __cc_runtime_tu_int halved = a >> 1;
+    unsigned long long unused;
+    unsigned long long q = __cc_runtime_udiv128by64to64preinv(
+        (unsigned long long)(halved >> 64), (unsigned long long)halved, d, v,
+        &unused);
+    q >>= 63 - shift;
+    if (q != 0)
+      --q;
+    __cc_runtime_tu_int r = a - q * b;
+    if (r >= b) {
+      ++q;
+      r -= b;
+    }
+    if (rem)
+      *rem = r;
+    return q;
+  }
+  return __udivmodti4(a, b, rem);
+}
+
+// Returns: a / b
+CC_RUNTIME_DIVTI_INLINE __cc_runtime_tu_int
+cc_runtime_udivti3(__cc_runtime_tu_int a, __cc_runtime_tu_int b) {
+  return cc_runtime_udivmodti4(a, b, 0);
+}
+
+// Returns: a % b
+CC_RUNTIME_DIVTI_INLINE __cc_runtime_tu_int
+cc_runtime_umodti3(__cc_runtime_tu_int a, __cc_runtime_tu_int b) {
+  __cc_runtime_tu_int r;
+  cc_runtime_udivmodti4(a, b, &r);
+  return r;
+}
+
+// Effects: if rem != 0, *rem = a % b
+// Returns: a / b, rounded toward zero
+CC_RUNTIME_DIVTI_INLINE __cc_runtime_ti_int
+cc_runtime_divmodti4(__cc_runtime_ti_int a, __cc_runtime_ti_int b,
+                     __cc_runtime_ti_int *rem) {
+  const __cc_runtime_ti_int s_a = a >> 127;         // s_a = a < 0 ? -1 : 0
+  const __cc_runtime_ti_int s_b = b >> 127;         // s_b = b < 0 ? -1 : 0
+  const __cc_runtime_tu_int a_u = (__cc_runtime_tu_int)(a ^ s_a) - s_a;
+  const __cc_runtime_tu_int b_u = (__cc_runtime_tu_int)(b ^ s_b) - s_b;
+  const __cc_runtime_ti_int s_q = s_a ^ s_b;        // sign of quotient
+  __cc_runtime_tu_int r;
+  const __cc_runtime_tu_int q = cc_runtime_udivmodti4(a_u, b_u, &r);
+  if (rem)
+    *rem = (__cc_runtime_ti_int)((r ^ s_a) - s_a);  // negate if s_a == -1
+  return (__cc_runtime_ti_int)((q ^ s_q) - s_q);    // negate if s_q == -1
+}
+
+// Returns: a / b, rounded toward zero
+CC_RUNTIME_DIVTI_INLINE __cc_runtime_ti_int
+cc_runtime_divti3(__cc_runtime_ti_int a, __cc_runtime_ti_int b) {
+  return cc_runtime_divmodti4(a, b, 0);
+}
+
+// Returns: a % b, with the sign of a
+CC_RUNTIME_DIVTI_INLINE __cc_runtime_ti_int
+cc_runtime_modti3(__cc_runtime_ti_int a, __cc_runtime_ti_int b) {
+  __cc_runtime_ti_int r;
+  cc_runtime_divmodti4(a, b, &r);
+  return r;
+}
+
+#undef CC_RUNTIME_DIVTI_INLINE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SIZEOF_INT128__
+
+#endif // CC_RUNTIME_DIVTI_H
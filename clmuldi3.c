@@ -0,0 +1,61 @@
+//===-- clmuldi3.c - Implement __clmuldi3 ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __clmuldi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+
+#ifdef CRT_HAS_X86_VECTOR
+
+typedef long long v2di __attribute__((__vector_size__(16)));
+
+static __attribute__((__target__("pclmul,sse2"))) du_int
+clmul_pclmul(du_int a, du_int b, du_int *high) {
+  const v2di r =
+      __builtin_ia32_pclmulqdq128((v2di){(di_int)a, 0}, (v2di){(di_int)b, 0},
+                                  0);
+  *high = (du_int)r[1];
+  return (du_int)r[0];
+}
+
+#endif // CRT_HAS_X86_VECTOR
+
+// Returns: the low 64 bits of the carry-less (GF(2)[x]) product of a and b
+// Effects: *high = the high 64 bits of the product
+
+COMPILER_RT_ABI du_int __clmuldi3(du_int a, du_int b, du_int *high) {
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_PCLMUL)
+    return clmul_pclmul(a, b, high);
+#endif
+  // Multiply a by b four bits at a time, from a table of a times every 4 bit
+  // polynomial. The table is indexed by b, so unlike pclmulqdq this path
+  // does not run in constant time.
+  du_int table_low[16], table_high[16];
+  table_low[0] = table_high[0] = 0;
+  table_low[1] = a;
+  table_high[1] = 0;
+  for (int k = 2; k < 16; k += 2) {
+    table_low[k] = table_low[k / 2] << 1;
+    table_high[k] = (table_high[k / 2] << 1) | (table_low[k / 2] >> 63);
+    table_low[k + 1] = table_low[k] ^ a;
+    table_high[k + 1] = table_high[k];
+  }
+  du_int low = 0, hi = 0;
+  for (int i = 60; i >= 0; i -= 4) {
+    const int k = (b >> i) & 15;
+    hi = (hi << 4) | (low >> 60);
+    low = (low << 4) ^ table_low[k];
+    hi ^= table_high[k];
+  }
+  *high = hi;
+  return low;
+}
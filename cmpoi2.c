@@ -0,0 +1,27 @@
+//===-- cmpoi2.c - Implement __cmpoi2 -------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __cmpoi2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns:  if (a <  b) returns 0
+//           if (a == b) returns 1
+//           if (a >  b) returns 2
+
+COMPILER_RT_ABI si_int __cmpoi2(oi_int a, oi_int b) {
+  const si_int gt = (a.high > b.high) | ((a.high == b.high) & (a.low > b.low));
+  const si_int lt = (a.high < b.high) | ((a.high == b.high) & (a.low < b.low));
+  return 1 + gt - lt;
+}
+
+#endif // CRT_HAS_128BIT
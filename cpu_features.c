@@ -0,0 +1,95 @@
+//===-- cpu_features.c - Implement processor feature detection ------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file computes the processor feature bits declared in int_cpu.h.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_cpu.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+#include <cpuid.h>
+
+su_int __crt_cpu_feature_bits;
+
+static su_int compute_features(void) {
+  su_int features = CRT_CPU_INITIALIZED;
+  unsigned max_leaf, vendor_b, vendor_c, vendor_d;
+  unsigned eax, ebx, ecx, edx;
+  if (!__get_cpuid(0, &max_leaf, &vendor_b, &vendor_c, &vendor_d))
+    return features;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    return features;
+
+  unsigned family = (eax >> 8) & 0xf;
+  unsigned model = (eax >> 4) & 0xf;
+  if (family == 0x6 || family == 0xf)
+    model |= ((eax >> 16) & 0xf) << 4;
+  if (family == 0xf)
+    family += (eax >> 20) & 0xff;
+
+  const bool intel = vendor_b == 0x756e6547 && vendor_d == 0x49656e69 &&
+                     vendor_c == 0x6c65746e; // "GenuineIntel"
+  const bool amd = vendor_b == 0x68747541 && vendor_d == 0x69746e65 &&
+                   vendor_c == 0x444d4163; // "AuthenticAMD"
+
+  // divq takes 40 to 90 cycles up to Comet Lake on Intel and up to Zen 2 on
+  // AMD; later cores have a radix-16 divider. Only the known slow parts are
+  // marked, so that families after 6 get the fast path: NetBurst (family 0xf)
+  // and the family 6 cores before Cannon Lake (0x66), with Kaby Lake, Coffee
+  // Lake and Comet Lake (0x8e, 0x9e, 0xa5, 0xa6) numbered above it. Before
+  // Zen 3, AMD cores also microcode pdep and pext.
+  if (intel) {
+    if (family == 0xf ||
+        (family == 0x6 && (model < 0x66 || model == 0x8e || model == 0x9e ||
+                           model == 0xa5 || model == 0xa6)))
+      features |= CRT_CPU_SLOW_DIVQ;
+  } else if (amd) {
+    if (family < 0x19)
+      features |= CRT_CPU_SLOW_DIVQ | CRT_CPU_SLOW_PDEP;
+  }
+
+  if (ecx & bit_SSSE3)
+    features |= CRT_CPU_SSSE3;
+  if (ecx & bit_PCLMUL)
+    features |= CRT_CPU_PCLMUL;
+
+  // The ymm and zmm registers are only usable once the OS has enabled their
+  // state in XCR0.
+  bool ymm_enabled = false;
+  bool zmm_enabled = false;
+  if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX)) {
+    unsigned xcr0, xcr0_high;
+    __asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0_high) : "c"(0));
+    ymm_enabled = (xcr0 & 0x6) == 0x6;
+    zmm_enabled = (xcr0 & 0xe6) == 0xe6;
+  }
+
+  if (max_leaf < 7)
+    return features;
+  __cpuid_count(7, 0, eax, ebx, ecx, edx);
+  if (ymm_enabled && (ebx & bit_AVX2))
+    features |= CRT_CPU_AVX2;
+  if (ebx & bit_BMI2)
+    features |= CRT_CPU_BMI2;
+  if (ebx & bit_ADX)
+    features |= CRT_CPU_ADX;
+  if (zmm_enabled && (ebx & bit_AVX512F) && (ecx & bit_AVX512VPOPCNTDQ))
+    features |= CRT_CPU_AVX512_VPOPCNTDQ;
+  return features;
+}
+
+// Computing the bits twice is harmless, so racing callers need no lock.
+su_int __crt_cpu_features_init(void) {
+  const su_int features = compute_features();
+  __atomic_store_n(&__crt_cpu_feature_bits, features, __ATOMIC_RELAXED);
+  return features;
+}
+
+#endif // defined(__i386__) || defined(__x86_64__)
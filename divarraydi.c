@@ -0,0 +1,163 @@
+//===-- divarraydi.c - Implement __udivdi3_1 and friends ------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 64 bit division over arrays for the compiler_rt
+// library: __udivdi3_1 and __divdi3_1 divide every element by one divisor,
+// __udivdi3_n and __divdi3_n divide two arrays element by element.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+#include "int_udiv128.h"
+
+typedef du_int fixuint_t;
+typedef di_int fixint_t;
+typedef du_divinv udivinv_t;
+typedef di_divinv divinv_t;
+
+#define COMPUTE_CLZ(a) __builtin_clzll(a)
+#define COMPUTE_UMULHI(a, b) umulhidi((a), (b))
+#define COMPUTE_UDIV2BY1(h, d, r) udiv2by1di((h), (d), (r))
+#include "int_divinv_impl.inc"
+
+// On CPUs without 64 bit hardware division support,
+//  this calls __udivdi3 (notice the cast to du_int).
+// On CPUs with 64 bit hardware division support,
+//  this uses the unsigned division instruction.
+#define COMPUTE_UDIV(a, b) ((du_int)(a) / (du_int)(b))
+#include "int_div_impl.inc"
+
+#ifdef CRT_HAS_X86_VECTOR
+
+typedef du_int v4du __attribute__((__vector_size__(32)));
+typedef long long v4di __attribute__((__vector_size__(32)));
+typedef si_int v8si __attribute__((__vector_size__(32)));
+
+#define AVX2 __attribute__((__target__("avx2")))
+
+// Returns: the high 64 bits of each lane-wise product a * b.
+// AVX2 has no 64 bit multiply-high, so it is put together from four
+// 32x32 -> 64 bit vpmuludq products.
+static __inline AVX2 v4du umulhi_avx2(v4du a, v4du b) {
+  const v4du a_hi = a >> 32;
+  const v4du b_hi = b >> 32;
+  const v4du ll = (v4du)__builtin_ia32_pmuludq256((v8si)a, (v8si)b);
+  const v4du lh = (v4du)__builtin_ia32_pmuludq256((v8si)a, (v8si)b_hi);
+  const v4du hl = (v4du)__builtin_ia32_pmuludq256((v8si)a_hi, (v8si)b);
+  const v4du hh = (v4du)__builtin_ia32_pmuludq256((v8si)a_hi, (v8si)b_hi);
+  // Sum terms that contribute to the low half in a way that allows us to get
+  // the carry
+  const v4du t = hl + (ll >> 32);
+  const v4du w = (t & 0xFFFFFFFF) + lh;
+  return hh + (t >> 32) + (w >> 32);
+}
+
+// Returns: a / inv.divisor for each lane.
+static __inline AVX2 v4du udivinv_avx2(v4du a, du_divinv inv) {
+  if (!inv.magic)
+    return a >> inv.shift;
+  const v4du q = umulhi_avx2(a, (v4du){} + inv.magic);
+  if (inv.flags & DIVINV_ADD_MARKER)
+    return (((a - q) >> 1) + q) >> inv.shift;
+  return q >> inv.shift;
+}
+
+// Effects: q[i] = a[i] / inv.divisor for i < n, n a multiple of 4.
+static AVX2 void udiv1_avx2(du_int *q, const du_int *a, du_divinv inv,
+                            size_t n) {
+  for (size_t i = 0; i < n; i += 4) {
+    v4du x;
+    __builtin_memcpy(&x, a + i, sizeof(x));
+    x = udivinv_avx2(x, inv);
+    __builtin_memcpy(q + i, &x, sizeof(x));
+  }
+}
+
+// Effects: q[i] = a[i] / d for i < n, n a multiple of 4. inv holds |d| and
+// s is d < 0 ? -1 : 0.
+static AVX2 void div1_avx2(di_int *q, const di_int *a, du_divinv inv,
+                           di_int s, size_t n) {
+  for (size_t i = 0; i < n; i += 4) {
+    v4di x;
+    __builtin_memcpy(&x, a + i, sizeof(x));
+    const v4di s_a = x < (v4di){};                  // s_a = x < 0 ? -1 : 0
+    const v4du abs_x = (v4du)((x ^ s_a) - s_a);     // negate if s_a == -1
+    const v4di s_q = s_a ^ s;                       // sign of quotient
+    x = ((v4di)udivinv_avx2(abs_x, inv) ^ s_q) - s_q;
+    __builtin_memcpy(q + i, &x, sizeof(x));
+  }
+}
+
+#endif // CRT_HAS_X86_VECTOR
+
+// Effects: q[i] = a[i] / d for i < n
+// d == 0 cases are undefined. q may be the same array as a.
+
+COMPILER_RT_ABI void __udivdi3_1(du_int *q, const du_int *a, du_int d,
+                                 size_t n) {
+  du_divinv inv;
+  __udivinvXi_init(&inv, d);
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2) {
+    const size_t done = n & ~(size_t)3;
+    udiv1_avx2(q, a, inv, done);
+    q += done;
+    a += done;
+    n -= done;
+  }
+#endif
+  for (size_t i = 0; i < n; ++i)
+    q[i] = __udivinvXi3(a[i], &inv);
+}
+
+// Effects: q[i] = a[i] / d for i < n, rounded toward zero
+// d == 0 cases are undefined. q may be the same array as a.
+
+COMPILER_RT_ABI void __divdi3_1(di_int *q, const di_int *a, di_int d,
+                                size_t n) {
+  // Divide the magnitudes and fix up the signs, as __divXi3 does.
+  const di_int s = d >> 63;                         // s = d < 0 ? -1 : 0
+  du_divinv inv;
+  __udivinvXi_init(&inv, ((du_int)d ^ s) - s);      // negate if s == -1
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2) {
+    const size_t done = n & ~(size_t)3;
+    div1_avx2(q, a, inv, s, done);
+    q += done;
+    a += done;
+    n -= done;
+  }
+#endif
+  for (size_t i = 0; i < n; ++i) {
+    const di_int s_a = a[i] >> 63;                  // s_a = a < 0 ? -1 : 0
+    const di_int s_q = s_a ^ s;                     // sign of quotient
+    const du_int abs_a = ((du_int)a[i] ^ s_a) - s_a;
+    q[i] = (__udivinvXi3(abs_a, &inv) ^ s_q) - s_q;
+  }
+}
+
+// Effects: q[i] = a[i] / b[i] for i < n
+// b[i] == 0 cases are undefined. q may be the same array as a or b.
+
+COMPILER_RT_ABI void __udivdi3_n(du_int *q, const du_int *a, const du_int *b,
+                                 size_t n) {
+  // A double quotient is not precise enough for 64 bit operands and the
+  // divisors change with every element, so this is a plain loop.
+  for (size_t i = 0; i < n; ++i)
+    q[i] = COMPUTE_UDIV(a[i], b[i]);
+}
+
+// Effects: q[i] = a[i] / b[i] for i < n, rounded toward zero
+// b[i] == 0 cases are undefined. q may be the same array as a or b.
+
+COMPILER_RT_ABI void __divdi3_n(di_int *q, const di_int *a, const di_int *b,
+                                size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    q[i] = __divXi3(a[i], b[i]);
+}
@@ -0,0 +1,221 @@
+//===-- divarraysi.c - Implement __udivsi3_1 and friends ------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 32 bit division over arrays for the compiler_rt
+// library: __udivsi3_1 and __divsi3_1 divide every element by one divisor,
+// __udivsi3_n and __divsi3_n divide two arrays element by element.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+#include "int_udiv128.h"
+
+typedef su_int fixuint_t;
+typedef si_int fixint_t;
+typedef su_divinv udivinv_t;
+typedef si_divinv divinv_t;
+
+#define COMPUTE_CLZ(a) clzsi(a)
+#define COMPUTE_UMULHI(a, b) umulhisi((a), (b))
+#define COMPUTE_UDIV2BY1(h, d, r) udiv2by1si((h), (d), (r))
+#include "int_divinv_impl.inc"
+
+// On CPUs without unsigned hardware division support,
+//  this calls __udivsi3 (notice the cast to su_int).
+// On CPUs with unsigned hardware division support,
+//  this uses the unsigned division instruction.
+#define COMPUTE_UDIV(a, b) ((su_int)(a) / (su_int)(b))
+#include "int_div_impl.inc"
+
+#ifdef CRT_HAS_X86_VECTOR
+
+typedef su_int v8su __attribute__((__vector_size__(32)));
+typedef si_int v8si __attribute__((__vector_size__(32)));
+typedef du_int v4du __attribute__((__vector_size__(32)));
+typedef su_int v4su __attribute__((__vector_size__(16)));
+typedef si_int v4si __attribute__((__vector_size__(16)));
+typedef double v4df __attribute__((__vector_size__(32)));
+
+#define AVX2 __attribute__((__target__("avx2")))
+
+// Returns: the high 32 bits of each lane-wise product a * b.
+static __inline AVX2 v8su umulhi_avx2(v8su a, v8su b) {
+  // vpmuludq multiplies the even lanes into 64 bit products.
+  const v8su even = (v8su)__builtin_ia32_pmuludq256((v8si)a, (v8si)b);
+  const v8su odd = (v8su)__builtin_ia32_pmuludq256(
+      (v8si)((v4du)a >> 32), (v8si)((v4du)b >> 32));
+  const v8su odd_lanes = {0, ~0U, 0, ~0U, 0, ~0U, 0, ~0U};
+  return (v8su)((v4du)even >> 32) | (odd & odd_lanes);
+}
+
+// Returns: a / inv.divisor for each lane.
+static __inline AVX2 v8su udivinv_avx2(v8su a, su_divinv inv) {
+  if (!inv.magic)
+    return a >> inv.shift;
+  const v8su q = umulhi_avx2(a, (v8su){} + inv.magic);
+  if (inv.flags & DIVINV_ADD_MARKER)
+    return (((a - q) >> 1) + q) >> inv.shift;
+  return q >> inv.shift;
+}
+
+// Effects: q[i] = a[i] / inv.divisor for i < n, n a multiple of 8.
+static AVX2 void udiv1_avx2(su_int *q, const su_int *a, su_divinv inv,
+                            size_t n) {
+  for (size_t i = 0; i < n; i += 8) {
+    v8su x;
+    __builtin_memcpy(&x, a + i, sizeof(x));
+    x = udivinv_avx2(x, inv);
+    __builtin_memcpy(q + i, &x, sizeof(x));
+  }
+}
+
+// Effects: q[i] = a[i] / d for i < n, n a multiple of 8. inv holds |d| and
+// s is d < 0 ? -1 : 0.
+static AVX2 void div1_avx2(si_int *q, const si_int *a, su_divinv inv,
+                           si_int s, size_t n) {
+  for (size_t i = 0; i < n; i += 8) {
+    v8si x;
+    __builtin_memcpy(&x, a + i, sizeof(x));
+    const v8si s_a = x >> 31;                       // s_a = x < 0 ? -1 : 0
+    const v8su abs_x = (v8su)((x ^ s_a) - s_a);     // negate if s_a == -1
+    const v8si s_q = s_a ^ s;                       // sign of quotient
+    x = ((v8si)udivinv_avx2(abs_x, inv) ^ s_q) - s_q;
+    __builtin_memcpy(q + i, &x, sizeof(x));
+  }
+}
+
+// A 32 bit quotient rounded to double is never rounded up to the next
+// integer (it is at least 2^-32 below it, relative to the quotient), so
+// truncating the double quotient gives the exact integer one.
+
+// Returns: a / b for each lane, a and b converted to double beforehand.
+static __inline AVX2 v4df div_pd_avx2(v4df a, v4df b) {
+  // Round toward zero without raising the inexact exception.
+  return __builtin_ia32_roundpd256(a / b, 0xb);
+}
+
+// Returns: the unsigned lanes of a as doubles.
+static __inline AVX2 v4df cvtu32_pd_avx2(v4su a) {
+  return __builtin_convertvector((v4si)(a ^ 0x80000000U), v4df) + 0x1p31;
+}
+
+// Effects: q[i] = a[i] / b[i] for i < n, n a multiple of 4.
+static AVX2 void udivn_avx2(su_int *q, const su_int *a, const su_int *b,
+                            size_t n) {
+  for (size_t i = 0; i < n; i += 4) {
+    v4su x, y;
+    __builtin_memcpy(&x, a + i, sizeof(x));
+    __builtin_memcpy(&y, b + i, sizeof(y));
+    const v4df t = div_pd_avx2(cvtu32_pd_avx2(x), cvtu32_pd_avx2(y));
+    x = (v4su)__builtin_convertvector(t - 0x1p31, v4si) ^ 0x80000000U;
+    __builtin_memcpy(q + i, &x, sizeof(x));
+  }
+}
+
+// Effects: q[i] = a[i] / b[i] for i < n, n a multiple of 4.
+static AVX2 void divn_avx2(si_int *q, const si_int *a, const si_int *b,
+                           size_t n) {
+  for (size_t i = 0; i < n; i += 4) {
+    v4si x, y;
+    __builtin_memcpy(&x, a + i, sizeof(x));
+    __builtin_memcpy(&y, b + i, sizeof(y));
+    // INT_MIN / -1 converts 2^31 back, which vcvttpd2dq turns into INT_MIN
+    // like __divsi3 does.
+    x = __builtin_convertvector(__builtin_convertvector(x, v4df) /
+                                    __builtin_convertvector(y, v4df),
+                                v4si);
+    __builtin_memcpy(q + i, &x, sizeof(x));
+  }
+}
+
+#endif // CRT_HAS_X86_VECTOR
+
+// Effects: q[i] = a[i] / d for i < n
+// d == 0 cases are undefined. q may be the same array as a.
+
+COMPILER_RT_ABI void __udivsi3_1(su_int *q, const su_int *a, su_int d,
+                                 size_t n) {
+  su_divinv inv;
+  __udivinvXi_init(&inv, d);
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2) {
+    const size_t done = n & ~(size_t)7;
+    udiv1_avx2(q, a, inv, done);
+    q += done;
+    a += done;
+    n -= done;
+  }
+#endif
+  for (size_t i = 0; i < n; ++i)
+    q[i] = __udivinvXi3(a[i], &inv);
+}
+
+// Effects: q[i] = a[i] / d for i < n, rounded toward zero
+// d == 0 cases are undefined. q may be the same array as a.
+
+COMPILER_RT_ABI void __divsi3_1(si_int *q, const si_int *a, si_int d,
+                                size_t n) {
+  // Divide the magnitudes and fix up the signs, as __divXi3 does.
+  const si_int s = d >> 31;                         // s = d < 0 ? -1 : 0
+  su_divinv inv;
+  __udivinvXi_init(&inv, ((su_int)d ^ s) - s);      // negate if s == -1
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2) {
+    const size_t done = n & ~(size_t)7;
+    div1_avx2(q, a, inv, s, done);
+    q += done;
+    a += done;
+    n -= done;
+  }
+#endif
+  for (size_t i = 0; i < n; ++i) {
+    const si_int s_a = a[i] >> 31;                  // s_a = a < 0 ? -1 : 0
+    const si_int s_q = s_a ^ s;                     // sign of quotient
+    const su_int abs_a = ((su_int)a[i] ^ s_a) - s_a;
+    q[i] = (__udivinvXi3(abs_a, &inv) ^ s_q) - s_q;
+  }
+}
+
+// Effects: q[i] = a[i] / b[i] for i < n
+// b[i] == 0 cases are undefined. q may be the same array as a or b.
+
+COMPILER_RT_ABI void __udivsi3_n(su_int *q, const su_int *a, const su_int *b,
+                                 size_t n) {
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2) {
+    const size_t done = n & ~(size_t)3;
+    udivn_avx2(q, a, b, done);
+    q += done;
+    a += done;
+    b += done;
+    n -= done;
+  }
+#endif
+  for (size_t i = 0; i < n; ++i)
+    q[i] = COMPUTE_UDIV(a[i], b[i]);
+}
+
+// Effects: q[i] = a[i] / b[i] for i < n, rounded toward zero
+// b[i] == 0 cases are undefined. q may be the same array as a or b.
+
+COMPILER_RT_ABI void __divsi3_n(si_int *q, const si_int *a, const si_int *b,
+                                size_t n) {
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2) {
+    const size_t done = n & ~(size_t)3;
+    divn_avx2(q, a, b, done);
+    q += done;
+    a += done;
+    b += done;
+    n -= done;
+  }
+#endif
+  for (size_t i = 0; i < n; ++i)
+    q[i] = __divXi3(a[i], b[i]);
+}
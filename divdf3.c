@@ -15,9 +15,6 @@
 
 #define DOUBLE_PRECISION
 
-#define NUMBER_OF_HALF_ITERATIONS 3
-#define NUMBER_OF_FULL_ITERATIONS 1
-
 #include "fp_div_impl.inc"
 
 COMPILER_RT_ABI fp_t __divdf3(fp_t a, fp_t b) { return __divXf3__(a, b); }
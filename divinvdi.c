@@ -0,0 +1,61 @@
+//===-- divinvdi.c - Implement __udivinvdi3 and __divinvdi3 ---------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 64 bit division by a precomputed invariant divisor
+// for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+typedef du_int fixuint_t;
+typedef di_int fixint_t;
+typedef du_divinv udivinv_t;
+typedef di_divinv divinv_t;
+
+#define COMPUTE_CLZ(a) __builtin_clzll(a)
+#define COMPUTE_UMULHI(a, b) umulhidi((a), (b))
+#define COMPUTE_UDIV2BY1(h, d, r) udiv2by1di((h), (d), (r))
+#include "int_divinv_impl.inc"
+
+// Effects: prepares *inv for dividing by d
+
+COMPILER_RT_ABI void __udivinvdi_init(du_divinv *inv, du_int d) {
+  __udivinvXi_init(inv, d);
+}
+
+// Returns: a / d
+
+COMPILER_RT_ABI du_int __udivinvdi3(du_int a, const du_divinv *inv) {
+  return __udivinvXi3(a, inv);
+}
+
+// Returns: a % d
+
+COMPILER_RT_ABI du_int __umodinvdi3(du_int a, const du_divinv *inv) {
+  return __umodinvXi3(a, inv);
+}
+
+// Effects: prepares *inv for dividing by d
+
+COMPILER_RT_ABI void __divinvdi_init(di_divinv *inv, di_int d) {
+  __divinvXi_init(inv, d);
+}
+
+// Returns: a / d
+
+COMPILER_RT_ABI di_int __divinvdi3(di_int a, const di_divinv *inv) {
+  return __divinvXi3(a, inv);
+}
+
+// Returns: a % d
+
+COMPILER_RT_ABI di_int __modinvdi3(di_int a, const di_divinv *inv) {
+  return __modinvXi3(a, inv);
+}
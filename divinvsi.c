@@ -0,0 +1,61 @@
+//===-- divinvsi.c - Implement __udivinvsi3 and __divinvsi3 ---------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 32 bit division by a precomputed invariant divisor
+// for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+typedef su_int fixuint_t;
+typedef si_int fixint_t;
+typedef su_divinv udivinv_t;
+typedef si_divinv divinv_t;
+
+#define COMPUTE_CLZ(a) clzsi(a)
+#define COMPUTE_UMULHI(a, b) umulhisi((a), (b))
+#define COMPUTE_UDIV2BY1(h, d, r) udiv2by1si((h), (d), (r))
+#include "int_divinv_impl.inc"
+
+// Effects: prepares *inv for dividing by d
+
+COMPILER_RT_ABI void __udivinvsi_init(su_divinv *inv, su_int d) {
+  __udivinvXi_init(inv, d);
+}
+
+// Returns: a / d
+
+COMPILER_RT_ABI su_int __udivinvsi3(su_int a, const su_divinv *inv) {
+  return __udivinvXi3(a, inv);
+}
+
+// Returns: a % d
+
+COMPILER_RT_ABI su_int __umodinvsi3(su_int a, const su_divinv *inv) {
+  return __umodinvXi3(a, inv);
+}
+
+// Effects: prepares *inv for dividing by d
+
+COMPILER_RT_ABI void __divinvsi_init(si_divinv *inv, si_int d) {
+  __divinvXi_init(inv, d);
+}
+
+// Returns: a / d
+
+COMPILER_RT_ABI si_int __divinvsi3(si_int a, const si_divinv *inv) {
+  return __divinvXi3(a, inv);
+}
+
+// Returns: a % d
+
+COMPILER_RT_ABI si_int __modinvsi3(si_int a, const si_divinv *inv) {
+  return __modinvXi3(a, inv);
+}
@@ -0,0 +1,66 @@
+//===-- divinvti.c - Implement __udivinvti3 and __divinvti3 ---------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 128 bit division by a precomputed invariant divisor
+// for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+#include "int_udiv128.h"
+
+typedef tu_int fixuint_t;
+typedef ti_int fixint_t;
+typedef tu_divinv udivinv_t;
+typedef ti_divinv divinv_t;
+
+#define COMPUTE_CLZ(a) __clzti2(a)
+#define COMPUTE_UMULHI(a, b) umulhiti((a), (b))
+#define COMPUTE_UDIV2BY1(h, d, r) udiv2by1ti((h), (d), (r))
+#include "int_divinv_impl.inc"
+
+// Effects: prepares *inv for dividing by d
+
+COMPILER_RT_ABI void __udivinvti_init(tu_divinv *inv, tu_int d) {
+  __udivinvXi_init(inv, d);
+}
+
+// Returns: a / d
+
+COMPILER_RT_ABI tu_int __udivinvti3(tu_int a, const tu_divinv *inv) {
+  return __udivinvXi3(a, inv);
+}
+
+// Returns: a % d
+
+COMPILER_RT_ABI tu_int __umodinvti3(tu_int a, const tu_divinv *inv) {
+  return __umodinvXi3(a, inv);
+}
+
+// Effects: prepares *inv for dividing by d
+
+COMPILER_RT_ABI void __divinvti_init(ti_divinv *inv, ti_int d) {
+  __divinvXi_init(inv, d);
+}
+
+// Returns: a / d
+
+COMPILER_RT_ABI ti_int __divinvti3(ti_int a, const ti_divinv *inv) {
+  return __divinvXi3(a, inv);
+}
+
+// Returns: a % d
+
+COMPILER_RT_ABI ti_int __modinvti3(ti_int a, const ti_divinv *inv) {
+  return __modinvXi3(a, inv);
+}
+
+#endif // CRT_HAS_128BIT
@@ -0,0 +1,31 @@
+//===-- divmoddi3.c - Implement __divmoddi3 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __divmoddi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+// Returns: { a / b, a % b }
+
+#define fixint_t di_int
+#define fixuint_t du_int
+// On CPUs without 64 bit hardware division support,
+//  this calls __udivdi3 once (notice the cast to du_int).
+// On CPUs with 64 bit hardware division support,
+//  this uses the unsigned division instruction.
+#define ASSIGN_UDIVMOD(q, r, a, b)                                             \
+  ((q) = (du_int)(a) / (du_int)(b), (r) = (a) - (q) * (b))
+#include "int_div_impl.inc"
+
+COMPILER_RT_ABI di_divmod __divmoddi3(di_int a, di_int b) {
+  di_divmod result;
+  result.quot = __divmodXi4(a, b, &result.rem);
+  return result;
+}
@@ -0,0 +1,44 @@
+//===-- divmodoi4.c - Implement __divmodoi4 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __divmodoi4 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+#include "int_oi.h"
+
+// Returns: (a ^ s) - s, with s either 0 or -1
+static __inline ou_int ou_negate_if(ou_int a, tu_int s) {
+  const ou_int zero = {0, 0};
+  su_int carry;
+  a.low ^= s;
+  a.high ^= s;
+  return ou_add(a, zero, (su_int)s & 1, &carry);
+}
+
+// Effects: if rem != 0, *rem = a % b
+// Returns: a / b, rounded toward zero
+
+COMPILER_RT_ABI oi_int __divmodoi4(oi_int a, oi_int b, oi_int *rem) {
+  const int N = (int)(sizeof(ti_int) * CHAR_BIT) - 1;
+  const tu_int s_a = (tu_int)(a.high >> N);         // s_a = a < 0 ? -1 : 0
+  const tu_int s_b = (tu_int)(b.high >> N);         // s_b = b < 0 ? -1 : 0
+  const ou_int abs_a = ou_negate_if(oi_to_ou(a), s_a);
+  const ou_int abs_b = ou_negate_if(oi_to_ou(b), s_b);
+  ou_int r;
+  const ou_int q = __udivmodoi4(abs_a, abs_b, &r);
+  if (rem)
+    *rem = ou_to_oi(ou_negate_if(r, s_a));          // sign of dividend
+  return ou_to_oi(ou_negate_if(q, s_a ^ s_b));      // sign of quotient
+}
+
+#endif // CRT_HAS_128BIT
@@ -0,0 +1,31 @@
+//===-- divmodsi3.c - Implement __divmodsi3 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __divmodsi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+// Returns: { a / b, a % b }
+
+#define fixint_t si_int
+#define fixuint_t su_int
+// On CPUs without unsigned hardware division support,
+//  this calls __udivsi3 once (notice the cast to su_int).
+// On CPUs with unsigned hardware division support,
+//  this uses the unsigned division instruction.
+#define ASSIGN_UDIVMOD(q, r, a, b)                                             \
+  ((q) = (su_int)(a) / (su_int)(b), (r) = (a) - (q) * (b))
+#include "int_div_impl.inc"
+
+COMPILER_RT_ABI si_divmod __divmodsi3(si_int a, si_int b) {
+  si_divmod result;
+  result.quot = __divmodXi4(a, b, &result.rem);
+  return result;
+}
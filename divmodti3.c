@@ -0,0 +1,30 @@
+//===-- divmodti3.c - Implement __divmodti3 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __divmodti3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: { a / b, a % b }
+
+#define fixint_t ti_int
+#define fixuint_t tu_int
+#define ASSIGN_UDIVMOD(q, r, a, b) ((q) = __udivmodti4((a), (b), &(r)))
+#include "int_div_impl.inc"
+
+COMPILER_RT_ABI ti_divmod __divmodti3(ti_int a, ti_int b) {
+  ti_divmod result;
+  result.quot = __divmodXi4(a, b, &result.rem);
+  return result;
+}
+
+#endif // CRT_HAS_128BIT
@@ -15,10 +15,6 @@
 
 #define SINGLE_PRECISION
 
-#define NUMBER_OF_HALF_ITERATIONS 0
-#define NUMBER_OF_FULL_ITERATIONS 3
-#define USE_NATIVE_FULL_ITERATIONS
-
 #include "fp_div_impl.inc"
 
 COMPILER_RT_ABI fp_t __divsf3(fp_t a, fp_t b) { return __divXf3__(a, b); }
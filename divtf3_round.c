@@ -0,0 +1,48 @@
+//===-- lib/divtf3_round.c - Quad-precision directed division -----*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements quad-precision soft-float division rounded toward
+// zero, downward and upward, whatever the current mode, and rounded both
+// downward and upward by a single call for interval arithmetic.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define QUAD_PRECISION
+#include "fp_lib.h"
+
+#if defined(CRT_HAS_IEEE_TF)
+
+#if defined(CRT_HAS_TF_MODE)
+
+#include "fp_div_impl.inc"
+
+COMPILER_RT_ABI fp_t __divtf3_rz(fp_t a, fp_t b) {
+  return __divXf3_round__(a, b, CRT_FE_TOWARDZERO);
+}
+
+COMPILER_RT_ABI fp_t __divtf3_rd(fp_t a, fp_t b) {
+  return __divXf3_round__(a, b, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI fp_t __divtf3_ru(fp_t a, fp_t b) {
+  return __divXf3_round__(a, b, CRT_FE_UPWARD);
+}
+
+// Both bounds at once, from a single quotient.
+
+COMPILER_RT_ABI void __divtf3_bounds(fp_t a, fp_t b, fp_t *lo, fp_t *hi) {
+  __divXf3_bounds__(a, b, lo, hi);
+}
+
+#endif
+
+#endif
+
+#endif
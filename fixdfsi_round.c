@@ -0,0 +1,47 @@
+//===-- fixdfsi_round.c - Implement __fixdfsi_rd and friends --------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __fixdfsi_rd, __fixdfsi_ru, __fixunsdfsi_rd and
+// __fixunsdfsi_ru for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define DOUBLE_PRECISION
+#include "fp_lib.h"
+
+typedef si_int fixint_t;
+typedef su_int fixuint_t;
+#include "fp_fixint_impl.inc"
+#include "fp_fixuint_impl.inc"
+
+// Returns: a converted to si_int, rounding downward or upward. Out of range
+//          values saturate to MIN or MAX, and NaN by its sign.
+
+COMPILER_RT_ABI si_int __fixdfsi_rd(fp_t a) {
+  return __fixint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI si_int __fixdfsi_ru(fp_t a) {
+  return __fixint_round(a, CRT_FE_UPWARD);
+}
+
+// Returns: a converted to su_int, rounding downward or upward. Values that
+//          round below 0 saturate to 0 and too large ones to UMAX; NaN
+//          saturates by its sign as with __fixunsdfsi.
+
+COMPILER_RT_ABI su_int __fixunsdfsi_rd(fp_t a) {
+  return __fixuint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI su_int __fixunsdfsi_ru(fp_t a) {
+  return __fixuint_round(a, CRT_FE_UPWARD);
+}
+
+#endif
@@ -0,0 +1,52 @@
+//===-- fixdfti_round.c - Implement __fixdfti_rd and friends --------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __fixdfti_rd, __fixdfti_ru, __fixunsdfti_rd and
+// __fixunsdfti_ru for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+#define DOUBLE_PRECISION
+#include "fp_lib.h"
+
+typedef ti_int fixint_t;
+typedef tu_int fixuint_t;
+#include "fp_fixint_impl.inc"
+#include "fp_fixuint_impl.inc"
+
+// Returns: a converted to ti_int, rounding downward or upward. Out of range
+//          values saturate to MIN or MAX, and NaN by its sign.
+
+COMPILER_RT_ABI ti_int __fixdfti_rd(fp_t a) {
+  return __fixint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI ti_int __fixdfti_ru(fp_t a) {
+  return __fixint_round(a, CRT_FE_UPWARD);
+}
+
+// Returns: a converted to tu_int, rounding downward or upward. Values that
+//          round below 0 saturate to 0 and too large ones to UMAX; NaN
+//          saturates by its sign as with __fixunsdfti.
+
+COMPILER_RT_ABI tu_int __fixunsdfti_rd(fp_t a) {
+  return __fixuint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI tu_int __fixunsdfti_ru(fp_t a) {
+  return __fixuint_round(a, CRT_FE_UPWARD);
+}
+
+#endif // CRT_HAS_128BIT
+
+#endif
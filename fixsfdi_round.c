@@ -0,0 +1,47 @@
+//===-- fixsfdi_round.c - Implement __fixsfdi_rd and friends --------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __fixsfdi_rd, __fixsfdi_ru, __fixunssfdi_rd and
+// __fixunssfdi_ru for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define SINGLE_PRECISION
+#include "fp_lib.h"
+
+typedef di_int fixint_t;
+typedef du_int fixuint_t;
+#include "fp_fixint_impl.inc"
+#include "fp_fixuint_impl.inc"
+
+// Returns: a converted to di_int, rounding downward or upward. Out of range
+//          values saturate to MIN or MAX, and NaN by its sign.
+
+COMPILER_RT_ABI di_int __fixsfdi_rd(fp_t a) {
+  return __fixint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI di_int __fixsfdi_ru(fp_t a) {
+  return __fixint_round(a, CRT_FE_UPWARD);
+}
+
+// Returns: a converted to du_int, rounding downward or upward. Values that
+//          round below 0 saturate to 0 and too large ones to UMAX; NaN
+//          saturates by its sign as with __fixunssfdi.
+
+COMPILER_RT_ABI du_int __fixunssfdi_rd(fp_t a) {
+  return __fixuint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI du_int __fixunssfdi_ru(fp_t a) {
+  return __fixuint_round(a, CRT_FE_UPWARD);
+}
+
+#endif
@@ -0,0 +1,47 @@
+//===-- fixsfsi_round.c - Implement __fixsfsi_rd and friends --------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __fixsfsi_rd, __fixsfsi_ru, __fixunssfsi_rd and
+// __fixunssfsi_ru for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define SINGLE_PRECISION
+#include "fp_lib.h"
+
+typedef si_int fixint_t;
+typedef su_int fixuint_t;
+#include "fp_fixint_impl.inc"
+#include "fp_fixuint_impl.inc"
+
+// Returns: a converted to si_int, rounding downward or upward. Out of range
+//          values saturate to MIN or MAX, and NaN by its sign.
+
+COMPILER_RT_ABI si_int __fixsfsi_rd(fp_t a) {
+  return __fixint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI si_int __fixsfsi_ru(fp_t a) {
+  return __fixint_round(a, CRT_FE_UPWARD);
+}
+
+// Returns: a converted to su_int, rounding downward or upward. Values that
+//          round below 0 saturate to 0 and too large ones to UMAX; NaN
+//          saturates by its sign as with __fixunssfsi.
+
+COMPILER_RT_ABI su_int __fixunssfsi_rd(fp_t a) {
+  return __fixuint_round(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI su_int __fixunssfsi_ru(fp_t a) {
+  return __fixuint_round(a, CRT_FE_UPWARD);
+}
+
+#endif
@@ -0,0 +1,46 @@
+//===-- fixtfsi_checked.c - Implement __fixtfsi_checked -------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __fixtfsi_checked and __fixunstfsi_checked for the
+// compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define QUAD_PRECISION
+#include "fp_lib.h"
+
+#if defined(CRT_HAS_IEEE_TF) && defined(CRT_HAS_TF_MODE)
+
+typedef si_int fixint_t;
+typedef su_int fixuint_t;
+#include "fp_fixchk_impl.inc"
+
+// Returns: a converted to si_int, rounding toward zero. Out of range values
+//          saturate to MIN or MAX as with __fixtfsi; NaN becomes 0.
+// Effects: *status = 0 if the result is exact, CRT_FIX_INEXACT (1) if a had a
+//          fractional part, CRT_FIX_INVALID (2) if a was NaN or out of range
+
+COMPILER_RT_ABI si_int __fixtfsi_checked(fp_t a, int *status) {
+  return __fixint_checked(a, status);
+}
+
+// Returns: a converted to su_int, rounding toward zero. Negative values
+//          saturate to 0, too large ones to UMAX and NaN becomes 0.
+// Effects: *status = 0 if the result is exact, CRT_FIX_INEXACT (1) if a had a
+//          fractional part, CRT_FIX_INVALID (2) if a was NaN or out of range.
+//          Negative values above -1 are inexact, not invalid.
+
+COMPILER_RT_ABI su_int __fixunstfsi_checked(fp_t a, int *status) {
+  return __fixuint_checked(a, status);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,49 @@
+//===-- fixxfdi_checked.c - Implement __fixxfdi_checked -------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __fixxfdi_checked and __fixunsxfdi_checked for the
+// compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#if !_ARCH_PPC
+
+#include "int_lib.h"
+
+#if HAS_80_BIT_LONG_DOUBLE == 1
+
+typedef di_int fixint_t;
+typedef du_int fixuint_t;
+#include "fp_fixchk_impl.inc"
+
+// Returns: a converted to di_int, rounding toward zero. Out of range values
+//          saturate to MIN or MAX as with __fixxfdi; NaN becomes 0.
+// Effects: *status = 0 if the result is exact, CRT_FIX_INEXACT (1) if a had a
+//          fractional part, CRT_FIX_INVALID (2) if a was NaN or out of range
+
+COMPILER_RT_ABI di_int __fixxfdi_checked(xf_float a, int *status) {
+  return __fixint_checked(a, status);
+}
+
+// Returns: a converted to du_int, rounding toward zero. Negative values
+//          saturate to 0, too large ones to UMAX and NaN becomes 0.
+// Effects: *status = 0 if the result is exact, CRT_FIX_INEXACT (1) if a had a
+//          fractional part, CRT_FIX_INVALID (2) if a was NaN or out of range.
+//          Negative values above -1 are inexact, not invalid.
+
+COMPILER_RT_ABI du_int __fixunsxfdi_checked(xf_float a, int *status) {
+  return __fixuint_checked(a, status);
+}
+
+#endif
+
+#endif // !_ARCH_PPC
+
+#endif
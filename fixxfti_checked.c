@@ -0,0 +1,53 @@
+//===-- fixxfti_checked.c - Implement __fixxfti_checked -------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __fixxfti_checked and __fixunsxfti_checked for the
+// compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#if !_ARCH_PPC
+
+#include "int_lib.h"
+
+#if HAS_80_BIT_LONG_DOUBLE == 1
+
+#ifdef CRT_HAS_128BIT
+
+typedef ti_int fixint_t;
+typedef tu_int fixuint_t;
+#include "fp_fixchk_impl.inc"
+
+// Returns: a converted to ti_int, rounding toward zero. Out of range values
+//          saturate to MIN or MAX as with __fixxfti; NaN becomes 0.
+// Effects: *status = 0 if the result is exact, CRT_FIX_INEXACT (1) if a had a
+//          fractional part, CRT_FIX_INVALID (2) if a was NaN or out of range
+
+COMPILER_RT_ABI ti_int __fixxfti_checked(xf_float a, int *status) {
+  return __fixint_checked(a, status);
+}
+
+// Returns: a converted to tu_int, rounding toward zero. Negative values
+//          saturate to 0, too large ones to UMAX and NaN becomes 0.
+// Effects: *status = 0 if the result is exact, CRT_FIX_INEXACT (1) if a had a
+//          fractional part, CRT_FIX_INVALID (2) if a was NaN or out of range.
+//          Negative values above -1 are inexact, not invalid.
+
+COMPILER_RT_ABI tu_int __fixunsxfti_checked(xf_float a, int *status) {
+  return __fixuint_checked(a, status);
+}
+
+#endif // CRT_HAS_128BIT
+
+#endif
+
+#endif // !_ARCH_PPC
+
+#endif
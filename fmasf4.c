@@ -0,0 +1,24 @@
+//===-- lib/fmasf4.c - Single-precision fused multiply-add --------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements single-precision soft-float fused multiply-add
+// with the IEEE-754 default rounding (to nearest, ties to even).
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define SINGLE_PRECISION
+
+#include "fp_fma_impl.inc"
+
+COMPILER_RT_ABI fp_t __fmasf4(fp_t a, fp_t b, fp_t c) {
+  return __fmaXf4__(a, b, c);
+}
+
+#endif
@@ -60,12 +60,20 @@ typedef double fp_t;
 
 static inline int rep_clz(rep_t a) { return __builtin_clzll(a); }
 
+// 64x64 -> 128 wide multiply. Where the compiler has a 128 bit type it emits
+// the target's own multiply-high (mul, mulx, umulh); this matters on 64-bit
+// targets built without hardware floating-point.
+#ifdef CRT_HAS_128BIT
+static __inline void wideMultiply(rep_t a, rep_t b, rep_t *hi, rep_t *lo) {
+  const __uint128_t product = (__uint128_t)a * b;
+  *hi = (rep_t)(product >> 64);
+  *lo = (rep_t)product;
+}
+#else
 #define loWord(a) (a & 0xffffffffU)
 #define hiWord(a) (a >> 32)
 
-// 64x64 -> 128 wide multiply for platforms that don't have such an operation;
-// many 64-bit platforms have this operation, but they tend to have hardware
-// floating-point, so we don't bother with a special case for them here.
+// Portable version built from 32x32 -> 64 products.
 static __inline void wideMultiply(rep_t a, rep_t b, rep_t *hi, rep_t *lo) {
   // Each of the component 32x32 -> 64 products
   const uint64_t plolo = loWord(a) * loWord(b);
@@ -81,6 +89,7 @@ static __inline void wideMultiply(rep_t a, rep_t b, rep_t *hi, rep_t *lo) {
 }
 #undef loWord
 #undef hiWord
+#endif // CRT_HAS_128BIT
 
 COMPILER_RT_ABI fp_t __adddf3(fp_t a, fp_t b);
 
@@ -125,65 +134,22 @@ static __inline int rep_clz(rep_t a) {
   return __builtin_clzll(word) + add;
 }
 
-#define Word_LoMask UINT64_C(0x00000000ffffffff)
-#define Word_HiMask UINT64_C(0xffffffff00000000)
-#define Word_FullMask UINT64_C(0xffffffffffffffff)
-#define Word_1(a) (uint64_t)((a >> 96) & Word_LoMask)
-#define Word_2(a) (uint64_t)((a >> 64) & Word_LoMask)
-#define Word_3(a) (uint64_t)((a >> 32) & Word_LoMask)
-#define Word_4(a) (uint64_t)(a & Word_LoMask)
-
-// 128x128 -> 256 wide multiply for platforms that don't have such an operation;
-// many 64-bit platforms have this operation, but they tend to have hardware
-// floating-point, so we don't bother with a special case for them here.
+// 128x128 -> 256 wide multiply, from four 64x64 -> 128 products of the
+// 64 bit limbs.
 static __inline void wideMultiply(rep_t a, rep_t b, rep_t *hi, rep_t *lo) {
-
-  const uint64_t product11 = Word_1(a) * Word_1(b);
-  const uint64_t product12 = Word_1(a) * Word_2(b);
-  const uint64_t product13 = Word_1(a) * Word_3(b);
-  const uint64_t product14 = Word_1(a) * Word_4(b);
-  const uint64_t product21 = Word_2(a) * Word_1(b);
-  const uint64_t product22 = Word_2(a) * Word_2(b);
-  const uint64_t product23 = Word_2(a) * Word_3(b);
-  const uint64_t product24 = Word_2(a) * Word_4(b);
-  const uint64_t product31 = Word_3(a) * Word_1(b);
-  const uint64_t product32 = Word_3(a) * Word_2(b);
-  const uint64_t product33 = Word_3(a) * Word_3(b);
-  const uint64_t product34 = Word_3(a) * Word_4(b);
-  const uint64_t product41 = Word_4(a) * Word_1(b);
-  const uint64_t product42 = Word_4(a) * Word_2(b);
-  const uint64_t product43 = Word_4(a) * Word_3(b);
-  const uint64_t product44 = Word_4(a) * Word_4(b);
-
-  const __uint128_t sum0 = (__uint128_t)product44;
-  const __uint128_t sum1 = (__uint128_t)product34 + (__uint128_t)product43;
-  const __uint128_t sum2 =
-      (__uint128_t)product24 + (__uint128_t)product33 + (__uint128_t)product42;
-  const __uint128_t sum3 = (__uint128_t)product14 + (__uint128_t)product23 +
-                           (__uint128_t)product32 + (__uint128_t)product41;
-  const __uint128_t sum4 =
-      (__uint128_t)product13 + (__uint128_t)product22 + (__uint128_t)product31;
-  const __uint128_t sum5 = (__uint128_t)product12 + (__uint128_t)product21;
-  const __uint128_t sum6 = (__uint128_t)product11;
-
-  const __uint128_t r0 = (sum0 & Word_FullMask) + ((sum1 & Word_LoMask) << 32);
-  const __uint128_t r1 = (sum0 >> 64) + ((sum1 >> 32) & Word_FullMask) +
-                         (sum2 & Word_FullMask) + ((sum3 << 32) & Word_HiMask);
-
-  *lo = r0 + (r1 << 64);
-  // The addition above can overflow, in which case `*lo` will be less than
-  // `r0`. Carry any overflow into `hi`.
-  const bool carry = *lo < r0;
-  *hi = (r1 >> 64) + (sum1 >> 96) + (sum2 >> 64) + (sum3 >> 32) + sum4 +
-        (sum5 << 32) + (sum6 << 64) + carry;
+  const uint64_t a_lo = (uint64_t)a, a_hi = (uint64_t)(a >> 64);
+  const uint64_t b_lo = (uint64_t)b, b_hi = (uint64_t)(b >> 64);
+  const __uint128_t plolo = (__uint128_t)a_lo * b_lo;
+  const __uint128_t plohi = (__uint128_t)a_lo * b_hi;
+  const __uint128_t philo = (__uint128_t)a_hi * b_lo;
+  const __uint128_t phihi = (__uint128_t)a_hi * b_hi;
+  // Sum terms that contribute to lo in a way that allows us to get the carry
+  const __uint128_t r1 =
+      (plolo >> 64) + (uint64_t)plohi + (__uint128_t)(uint64_t)philo;
+  *lo = (uint64_t)plolo | (r1 << 64);
+  // Sum terms contributing to hi with the carry from lo
+  *hi = (plohi >> 64) + (philo >> 64) + (r1 >> 64) + phihi;
 }
-#undef Word_1
-#undef Word_2
-#undef Word_3
-#undef Word_4
-#undef Word_HiMask
-#undef Word_LoMask
-#undef Word_FullMask
 #endif // defined(CRT_HAS_IEEE_TF)
 #else
 typedef long double fp_t;
@@ -255,6 +221,22 @@ static __inline void wideRightShiftWithSticky(rep_t *hi, rep_t *lo,
   }
 }
 
+// Effects: *lo and *hi are set to a result rounded downward and upward, given
+// the result rounded toward zero and whether that rounding was inexact. One of
+// the two is that result, and the other one the next value away from zero
+// when inexact is set.
+static __inline void directedBounds(rep_t towardZero, bool inexact, fp_t *lo,
+                                    fp_t *hi) {
+  const rep_t awayFromZero = towardZero + inexact;
+  if (towardZero & signBit) {
+    *lo = fromRep(awayFromZero);
+    *hi = fromRep(towardZero);
+  } else {
+    *lo = fromRep(towardZero);
+    *hi = fromRep(awayFromZero);
+  }
+}
+
 // Implements logb methods (logb, logbf, logbl) for IEEE-754. This avoids
 // pulling in a libm dependency from compiler-rt, but is not meant to replace
 // it (i.e. code calling logb() should get the one from libm, not this), hence
@@ -26,4 +26,25 @@ typedef enum {
 CRT_FE_ROUND_MODE __fe_getround(void);
 int __fe_raise_inexact(void);
 
+// Returns: 1 if a result truncated toward zero must be moved one unit away
+//          from zero to be rounded in mode, 0 otherwise. negative is the sign
+//          of the result and odd its last kept bit. half is the first bit
+//          discarded, and sticky is set if any bit below that one is.
+// The soft-float routines round through this one helper, so that a constant
+// mode folds down to the test that mode needs.
+static __inline int __fe_round_away(CRT_FE_ROUND_MODE mode, int negative,
+                                    int odd, int half, int sticky) {
+  switch (mode) {
+  case CRT_FE_TONEAREST:
+    return half && (sticky || odd);
+  case CRT_FE_DOWNWARD:
+    return negative && (half || sticky);
+  case CRT_FE_UPWARD:
+    return !negative && (half || sticky);
+  case CRT_FE_TOWARDZERO:
+    break;
+  }
+  return 0;
+}
+
 #endif // FP_MODE_H
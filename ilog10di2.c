@@ -0,0 +1,32 @@
+//===-- ilog10di2.c - Implement __ilog10di2 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __ilog10di2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+static const du_int powers_of_10[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+    1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL,
+};
+
+// Returns: floor(log10(a)), -1 if a == 0
+
+COMPILER_RT_ABI int __ilog10di2(du_int a) {
+  // log10(a) < (floor(log2(a)) + 1) * log10(2), and 1233 / 4096 is log10(2)
+  // close enough that t is floor(log10(a)) or one above it for every
+  // du_int. a == 0 gives t == 0 and then -1.
+  const int bits = a == 0 ? 0 : 64 - __builtin_clzll(a);
+  const int t = (bits * 1233) >> 12;
+  return t - (a < powers_of_10[t]);
+}
@@ -0,0 +1,28 @@
+//===-- ilog10si2.c - Implement __ilog10si2 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __ilog10si2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+static const su_int powers_of_10[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+// Returns: floor(log10(a)), -1 if a == 0
+
+COMPILER_RT_ABI int __ilog10si2(su_int a) {
+  // log10(a) < (floor(log2(a)) + 1) * log10(2), and 1233 / 4096 is log10(2)
+  // close enough that t is floor(log10(a)) or one above it for every
+  // su_int. a == 0 gives t == 0 and then -1.
+  const int bits = a == 0 ? 0 : 32 - clzsi(a);
+  const int t = (bits * 1233) >> 12;
+  return t - (a < powers_of_10[t]);
+}
@@ -0,0 +1,57 @@
+//===-- ilog10ti2.c - Implement __ilog10ti2 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __ilog10ti2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Powers of ten below 2^128. Those above 2^64 are spelled as products, as
+// there are no 128 bit integer literals.
+static const tu_int powers_of_10[39] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+    1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL,
+    (tu_int)10000000000000000000ULL * 10ULL,
+    (tu_int)10000000000000000000ULL * 100ULL,
+    (tu_int)10000000000000000000ULL * 1000ULL,
+    (tu_int)10000000000000000000ULL * 10000ULL,
+    (tu_int)10000000000000000000ULL * 100000ULL,
+    (tu_int)10000000000000000000ULL * 1000000ULL,
+    (tu_int)10000000000000000000ULL * 10000000ULL,
+    (tu_int)10000000000000000000ULL * 100000000ULL,
+    (tu_int)10000000000000000000ULL * 1000000000ULL,
+    (tu_int)10000000000000000000ULL * 10000000000ULL,
+    (tu_int)10000000000000000000ULL * 100000000000ULL,
+    (tu_int)10000000000000000000ULL * 1000000000000ULL,
+    (tu_int)10000000000000000000ULL * 10000000000000ULL,
+    (tu_int)10000000000000000000ULL * 100000000000000ULL,
+    (tu_int)10000000000000000000ULL * 1000000000000000ULL,
+    (tu_int)10000000000000000000ULL * 10000000000000000ULL,
+    (tu_int)10000000000000000000ULL * 100000000000000000ULL,
+    (tu_int)10000000000000000000ULL * 1000000000000000000ULL,
+    (tu_int)10000000000000000000ULL * 10000000000000000000ULL,
+};
+
+// Returns: floor(log10(a)), -1 if a == 0
+
+COMPILER_RT_ABI int __ilog10ti2(tu_int a) {
+  // log10(a) < (floor(log2(a)) + 1) * log10(2), and 1233 / 4096 is log10(2)
+  // close enough that t is floor(log10(a)) or one above it for every
+  // tu_int. a == 0 gives t == 0 and then -1.
+  const int bits = a == 0 ? 0 : 128 - __clzti2(a);
+  const int t = (bits * 1233) >> 12;
+  return t - (a < powers_of_10[t]);
+}
+
+#endif // CRT_HAS_128BIT
@@ -0,0 +1,21 @@
+//===-- ilog2di2.c - Implement __ilog2di2 ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __ilog2di2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+// Returns: floor(log2(a)), -1 if a == 0
+
+COMPILER_RT_ABI int __ilog2di2(du_int a) {
+  if (a == 0)
+    return -1;
+  return 63 - __builtin_clzll(a);
+}
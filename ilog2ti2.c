@@ -0,0 +1,25 @@
+//===-- ilog2ti2.c - Implement __ilog2ti2 ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __ilog2ti2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: floor(log2(a)), -1 if a == 0
+
+COMPILER_RT_ABI int __ilog2ti2(tu_int a) {
+  if (a == 0)
+    return -1;
+  return 127 - __clzti2(a);
+}
+
+#endif // CRT_HAS_128BIT
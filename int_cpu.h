@@ -0,0 +1,65 @@
+//===-- int_cpu.h - processor feature detection -----------------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file is not part of the interface of this library.
+//
+// This file declares the processor feature bits used by routines that pick
+// between several implementations at run time. The bits are computed once,
+// on first use, by cpu_features.c.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef INT_CPU_H
+#define INT_CPU_H
+
+#include "int_lib.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+
+// Set once the other bits are valid, so that a zero value means "unknown".
+#define CRT_CPU_INITIALIZED (1U << 0)
+// 64-bit divq is slow: Intel NetBurst, Intel family 6 models below Cannon Lake
+// (0x66) plus 0x8e, 0x9e, 0xa5 and 0xa6, and AMD cores before Zen 3.
+#define CRT_CPU_SLOW_DIVQ (1U << 1)
+// AVX2 is available and the OS saves the ymm registers.
+#define CRT_CPU_AVX2 (1U << 2)
+// BMI2 (mulx, pdep, pext) is available.
+#define CRT_CPU_BMI2 (1U << 3)
+// ADX (adcx, adox) is available.
+#define CRT_CPU_ADX (1U << 4)
+// AVX-512 VPOPCNTDQ is available and the OS saves the zmm registers.
+#define CRT_CPU_AVX512_VPOPCNTDQ (1U << 5)
+// SSSE3 (pshufb) is available.
+#define CRT_CPU_SSSE3 (1U << 6)
+// PCLMULQDQ is available.
+#define CRT_CPU_PCLMUL (1U << 7)
+// pdep and pext are microcoded, with a latency that grows with the number of
+// mask bits (pre-Zen 3 AMD cores).
+#define CRT_CPU_SLOW_PDEP (1U << 8)
+
+// Defined where the vector register paths may be built: only if the compiler
+// may use those registers itself. A kernel built with -mgeneral-regs-only or
+// -mno-sse does not save them, and a vector path would clobber the state of
+// the task it interrupted.
+#ifdef __SSE2__
+#define CRT_HAS_X86_VECTOR
+#endif
+
+extern su_int __crt_cpu_feature_bits;
+su_int __crt_cpu_features_init(void);
+
+// Returns: the CRT_CPU_* bits of the running processor.
+static __inline su_int crt_cpu_features(void) {
+  const su_int features =
+      __atomic_load_n(&__crt_cpu_feature_bits, __ATOMIC_RELAXED);
+  return features ? features : __crt_cpu_features_init();
+}
+
+#endif // defined(__i386__) || defined(__x86_64__)
+
+#endif // INT_CPU_H
@@ -0,0 +1,88 @@
+//===-- int_isqrt.h - Integer square root helpers --------------- -*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file is not part of the interface of this library.
+//
+// This file defines the square root cores shared by __isqrtsi2, __isqrtdi2
+// and __isqrtti2. They refine a table estimate of the reciprocal square root
+// with Newton-Raphson steps, as fp_div_impl.inc does for the reciprocal, and
+// multiply it back into the square root; no step divides. The soft-float
+// square roots in fp_sqrt_impl.inc start from rsqrt32 as well.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef INT_ISQRT_H
+#define INT_ISQRT_H
+
+#include "int_lib.h"
+
+// rsqrt_table[i] = floor(2^7 / sqrt((i + 33) / 128)): 1 / sqrt(x) in Q1.7 at
+// the top of each interval [(i + 32) / 128, (i + 33) / 128), so that it never
+// exceeds the true value within the interval and is correct to about 6 bits.
+UNUSED
+static const unsigned char rsqrt_table[96] = {
+    252, 248, 244, 241, 238, 234, 231, 228, 226, 223, 220, 218,
+    215, 213, 211, 209, 206, 204, 202, 200, 198, 197, 195, 193,
+    191, 190, 188, 186, 185, 183, 182, 181, 179, 178, 176, 175,
+    174, 173, 171, 170, 169, 168, 167, 166, 165, 163, 162, 161,
+    160, 159, 158, 158, 157, 156, 155, 154, 153, 152, 151, 150,
+    150, 149, 148, 147, 147, 146, 145, 144, 144, 143, 142, 142,
+    141, 140, 139, 139, 138, 138, 137, 136, 136, 135, 135, 134,
+    133, 133, 132, 132, 131, 131, 130, 130, 129, 129, 128, 128,
+};
+
+// Returns: r <= 2^31 / sqrt(a / 2^32), for 2^30 <= a < 2^32
+//
+// The table estimate is refined with steps r = r * (3 - a * r^2) / 2 in Q1.31.
+// Each step roughly doubles the number of correct bits; two give 22 and
+// three about 30, the limit of the fixed point precision. a * r^2 is rounded
+// up so that r stays below the true value and below 2^32, which keeps r * r
+// within 64 bits.
+UNUSED
+static inline du_int rsqrt32(su_int a, int steps) {
+  du_int r = (du_int)rsqrt_table[(a >> 25) - 32] << 24;
+  for (int i = 0; i < steps; ++i) {
+    const du_int ar2 = (((du_int)a * (((r * r) >> 32) + 1)) >> 32) + 1; // Q2.30
+    r = (r * ((3ULL << 30) - ar2)) >> 31;
+  }
+  return r;
+}
+
+// Returns: floor(sqrt(m)) for 2^30 <= m < 2^32
+UNUSED
+static inline su_int isqrt32norm(su_int m) {
+  const du_int r = rsqrt32(m, 2);
+  // m * r / 2^47 = sqrt(m) * (r / R), at most one below floor(sqrt(m)).
+  su_int s = (su_int)(((du_int)m * r) >> 47);
+  if ((du_int)(s + 1) * (s + 1) <= m)
+    ++s;
+  return s;
+}
+
+// Returns: floor(sqrt(m)) for 2^62 <= m < 2^64
+UNUSED
+static inline du_int isqrt64norm(du_int m) {
+  const su_int a = (su_int)(m >> 32);
+  const du_int r = rsqrt32(a, 3);
+  // sqrt(a * 2^32) from below, within 16 of floor(sqrt(m)).
+  du_int s = ((du_int)a * r) >> 31;
+  // One Newton step on the square root itself, s + (m - s^2) / (2 s), with
+  // 1 / (2 s) taken as r / 2^64. m - s^2 < 2^37, so (e >> 5) * r fits.
+  const du_int e = m - s * s;
+  s += ((e >> 5) * r) >> 59;
+  // The step can land one off either way.
+  if (s > 0xFFFFFFFF)
+    s = 0xFFFFFFFF;
+  if (s * s > m)
+    --s;
+  else if (m - s * s > 2 * s)
+    ++s;
+  return s;
+}
+
+#endif // INT_ISQRT_H
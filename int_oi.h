@@ -0,0 +1,125 @@
+//===-- int_oi.h - 256 bit integer helpers ----------------------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file is not part of the interface of this library.
+//
+// This file defines the inline helpers shared by the oi routines, which
+// operate on the oi_int and ou_int pairs from int_types.h.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef INT_OI_H
+#define INT_OI_H
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+UNUSED
+static inline ou_int oi_to_ou(oi_int a) {
+  ou_int r;
+  r.low = a.low;
+  r.high = (tu_int)a.high;
+  return r;
+}
+
+UNUSED
+static inline oi_int ou_to_oi(ou_int a) {
+  oi_int r;
+  r.low = a.low;
+  r.high = (ti_int)a.high;
+  return r;
+}
+
+// Returns: a + b + carry_in
+// Effects: *carry_out = carry out of the 256 bit sum
+// carry_in must be 0 or 1.
+UNUSED
+static inline ou_int ou_add(ou_int a, ou_int b, su_int carry_in,
+                            su_int *carry_out) {
+  ou_int r;
+  r.low = a.low + b.low;
+  tu_int carry = r.low < a.low;
+  // a.low + b.low wraps to at most 2^128 - 2, so only one of the two low
+  // carries can be set.
+  r.low += carry_in;
+  carry += r.low < carry_in;
+  r.high = a.high + b.high;
+  su_int carry_high = r.high < a.high;
+  r.high += carry;
+  carry_high += r.high < carry;
+  *carry_out = carry_high;
+  return r;
+}
+
+// Returns: a - b - borrow_in
+// Effects: *borrow_out = borrow out of the 256 bit difference
+// borrow_in must be 0 or 1.
+UNUSED
+static inline ou_int ou_sub(ou_int a, ou_int b, su_int borrow_in,
+                            su_int *borrow_out) {
+  ou_int r;
+  r.low = a.low - b.low;
+  tu_int borrow = a.low < b.low;
+  borrow += r.low < borrow_in;
+  r.low -= borrow_in;
+  r.high = a.high - b.high;
+  su_int borrow_high = a.high < b.high;
+  borrow_high += r.high < borrow;
+  r.high -= borrow;
+  *borrow_out = borrow_high;
+  return r;
+}
+
+// Returns: a << b
+// Precondition:  0 <= b < 256
+UNUSED
+static inline ou_int ou_shl(ou_int a, int b) {
+  const int bits_in_tword = (int)(sizeof(ti_int) * CHAR_BIT);
+  ou_int r;
+  if (b & bits_in_tword) /* bits_in_tword <= b < bits_in_oword */ {
+    r.low = 0;
+    r.high = a.low << (b - bits_in_tword);
+  } else /* 0 <= b < bits_in_tword */ {
+    if (b == 0)
+      return a;
+    r.low = a.low << b;
+    r.high = (a.high << b) | (a.low >> (bits_in_tword - b));
+  }
+  return r;
+}
+
+// Returns: logical a >> b
+// Precondition:  0 <= b < 256
+UNUSED
+static inline ou_int ou_lshr(ou_int a, int b) {
+  const int bits_in_tword = (int)(sizeof(ti_int) * CHAR_BIT);
+  ou_int r;
+  if (b & bits_in_tword) /* bits_in_tword <= b < bits_in_oword */ {
+    r.high = 0;
+    r.low = a.high >> (b - bits_in_tword);
+  } else /* 0 <= b < bits_in_tword */ {
+    if (b == 0)
+      return a;
+    r.high = a.high >> b;
+    r.low = (a.high << (bits_in_tword - b)) | (a.low >> b);
+  }
+  return r;
+}
+
+// Returns: 0 if a < b, 1 if a == b, 2 if a > b
+UNUSED
+static inline si_int ou_cmp(ou_int a, ou_int b) {
+  const si_int gt = (a.high > b.high) | ((a.high == b.high) & (a.low > b.low));
+  const si_int lt = (a.high < b.high) | ((a.high == b.high) & (a.low < b.low));
+  return 1 + gt - lt;
+}
+
+#endif // CRT_HAS_128BIT
+
+#endif // INT_OI_H
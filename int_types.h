@@ -63,6 +63,75 @@ typedef union {
   } s;
 } udwords;
 
+// Divisor descriptors for the invariant-divisor division routines. They are
+// filled in once by __udivinv[sd]i_init / __divinv[sd]i_init and then hold the
+// multiplier, the post-shift and the DIVINV_* flags (see int_divinv_impl.inc).
+typedef struct {
+  su_int magic;
+  su_int divisor;
+  unsigned char shift;
+  unsigned char flags;
+} su_divinv;
+
+typedef struct {
+  si_int magic;
+  si_int divisor;
+  unsigned char shift;
+  unsigned char flags;
+} si_divinv;
+
+typedef struct {
+  du_int magic;
+  du_int divisor;
+  unsigned char shift;
+  unsigned char flags;
+} du_divinv;
+
+typedef struct {
+  di_int magic;
+  di_int divisor;
+  unsigned char shift;
+  unsigned char flags;
+} di_divinv;
+
+// Precomputed constants for multiplication modulo a 64 bit m, filled in once
+// by __montdi_init / __barrettdi_init (see montdi.c and barrettdi.c).
+typedef struct {
+  du_int modulus;
+  du_int inverse; // modulus^-1 mod 2^64
+  du_int r1;      // 2^64 mod modulus, the Montgomery form of 1
+  du_int r2;      // 2^128 mod modulus
+} du_montgomery;
+
+typedef struct {
+  du_int modulus;
+  du_int normalized; // modulus << shift
+  du_int reciprocal; // reciprocal_word(normalized)
+  unsigned char shift;
+} du_barrett;
+
+// Quotient and remainder pairs returned by value by the __[u]divmod[sdt]i3
+// routines.
+typedef struct {
+  su_int quot;
+  su_int rem;
+} su_divmod;
+
+typedef struct {
+  si_int quot;
+  si_int rem;
+} si_divmod;
+
+typedef struct {
+  du_int quot;
+  du_int rem;
+} du_divmod;
+
+typedef struct {
+  di_int quot;
+  di_int rem;
+} di_divmod;
+
 #if defined(__LP64__) || defined(__wasm__) || defined(__mips64) ||             \
     defined(__SIZEOF_INT128__)
 #define CRT_HAS_128BIT
@@ -105,6 +174,52 @@ typedef union {
   } s;
 } utwords;
 
+typedef struct {
+  tu_int magic;
+  tu_int divisor;
+  unsigned char shift;
+  unsigned char flags;
+} tu_divinv;
+
+typedef struct {
+  ti_int magic;
+  ti_int divisor;
+  unsigned char shift;
+  unsigned char flags;
+} ti_divinv;
+
+typedef struct {
+  tu_int quot;
+  tu_int rem;
+} tu_divmod;
+
+typedef struct {
+  ti_int quot;
+  ti_int rem;
+} ti_divmod;
+
+// There is no native 256 bit integer type, so the oi routines pass their
+// operands as two 128 bit halves laid out like the words of twords.
+typedef struct {
+#if _YUGA_LITTLE_ENDIAN
+  tu_int low;
+  ti_int high;
+#else
+  ti_int high;
+  tu_int low;
+#endif // _YUGA_LITTLE_ENDIAN
+} oi_int;
+
+typedef struct {
+#if _YUGA_LITTLE_ENDIAN
+  tu_int low;
+  tu_int high;
+#else
+  tu_int high;
+  tu_int low;
+#endif // _YUGA_LITTLE_ENDIAN
+} ou_int;
+
 static __inline ti_int make_ti(di_int h, di_int l) {
   twords r;
   r.s.high = (du_int)h;
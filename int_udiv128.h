@@ -0,0 +1,293 @@
+//===-- int_udiv128.h - 128-by-64 bit division helpers ----------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file is not part of the interface of this library.
+//
+// This file defines the 128-by-64 bit division core used by __udivmodti4 and
+// by the other routines that need a double-word by single-word division, a
+// full double-word product or the high word of a product.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef INT_UDIV128_H
+#define INT_UDIV128_H
+
+#include "int_lib.h"
+
+// Returns the 128 bit division result by 64 bit. Result must fit in 64 bits.
+// Remainder stored in r.
+// Taken and adjusted from libdivide libdivide_128_div_64_to_64 division
+// fallback. For a correctness proof see the reference for this algorithm
+// in Knuth, Volume 2, section 4.3.1, Algorithm D.
+UNUSED
+static inline du_int udiv128by64to64default(du_int u1, du_int u0, du_int v,
+                                            du_int *r) {
+  const unsigned n_udword_bits = sizeof(du_int) * CHAR_BIT;
+  const du_int b = (1ULL << (n_udword_bits / 2)); // Number base (32 bits)
+  du_int un1, un0;                                // Norm. dividend LSD's
+  du_int vn1, vn0;                                // Norm. divisor digits
+  du_int q1, q0;                                  // Quotient digits
+  du_int un64, un21, un10;                        // Dividend digit pairs
+  du_int rhat;                                    // A remainder
+  si_int s;                                       // Shift amount for normalization
+
+  s = __builtin_clzll(v);
+  if (s > 0) {
+    // Normalize the divisor.
+    v = v << s;
+    un64 = (u1 << s) | (u0 >> (n_udword_bits - s));
+    un10 = u0 << s; // Shift dividend left
+  } else {
+    // Avoid undefined behavior of (u0 >> 64).
+    un64 = u1;
+    un10 = u0;
+  }
+
+  // Break divisor up into two 32-bit digits.
+  vn1 = v >> (n_udword_bits / 2);
+  vn0 = v & 0xFFFFFFFF;
+
+  // Break right half of dividend into two digits.
+  un1 = un10 >> (n_udword_bits / 2);
+  un0 = un10 & 0xFFFFFFFF;
+
+  // Compute the first quotient digit, q1.
+  q1 = un64 / vn1;
+  rhat = un64 - q1 * vn1;
+
+  // q1 has at most error 2. No more than 2 iterations.
+  while (q1 >= b || q1 * vn0 > b * rhat + un1) {
+    q1 = q1 - 1;
+    rhat = rhat + vn1;
+    if (rhat >= b)
+      break;
+  }
+
+  un21 = un64 * b + un1 - q1 * v;
+
+  // Compute the second quotient digit.
+  q0 = un21 / vn1;
+  rhat = un21 - q0 * vn1;
+
+  // q0 has at most error 2. No more than 2 iterations.
+  while (q0 >= b || q0 * vn0 > b * rhat + un0) {
+    q0 = q0 - 1;
+    rhat = rhat + vn1;
+    if (rhat >= b)
+      break;
+  }
+
+  *r = (un21 * b + un0 - q0 * v) >> s;
+  return q1 * b + q0;
+}
+
+UNUSED
+static inline du_int udiv128by64to64(du_int u1, du_int u0, du_int v,
+                                     du_int *r) {
+#if defined(__x86_64__)
+  du_int result;
+  __asm__("divq %[v]"
+          : "=a"(result), "=d"(*r)
+          : [ v ] "r"(v), "a"(u0), "d"(u1));
+  return result;
+#else
+  return udiv128by64to64default(u1, u0, v, r);
+#endif
+}
+
+// Returns the high 64 bits of the full product a * b.
+// The low 64 bits are stored in lo.
+UNUSED
+static inline du_int umul64x64to128(du_int a, du_int b, du_int *lo) {
+#ifdef CRT_HAS_128BIT
+  const tu_int product = (tu_int)a * b;
+  *lo = (du_int)product;
+  return (du_int)(product >> 64);
+#else
+  // Each of the component 32x32 -> 64 products
+  const du_int plolo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+  const du_int plohi = (a & 0xFFFFFFFF) * (b >> 32);
+  const du_int philo = (a >> 32) * (b & 0xFFFFFFFF);
+  const du_int phihi = (a >> 32) * (b >> 32);
+  // Sum terms that contribute to lo in a way that allows us to get the carry
+  const du_int r1 = (plolo >> 32) + (plohi & 0xFFFFFFFF) + (philo & 0xFFFFFFFF);
+  *lo = (plolo & 0xFFFFFFFF) + (r1 << 32);
+  // Sum terms contributing to hi with the carry from lo
+  return (plohi >> 32) + (philo >> 32) + (r1 >> 32) + phihi;
+#endif
+}
+
+// Reciprocal-based 128-by-64 bit division, from N. Moller and T. Granlund,
+// "Improved division by invariant integers", IEEE Transactions on Computers,
+// 2011. It trades the division for a handful of multiplies, which is cheaper
+// on cores with a slow divider and whenever one divisor is reused.
+
+// reciprocal_table[i] = floor((2^19 - 3 * 2^8) / (i + 256)), an 11-bit
+// estimate of the reciprocal of the top 9 bits of a normalized divisor.
+UNUSED
+static const unsigned short reciprocal_table[256] = {
+    0x7fd, 0x7f5, 0x7ed, 0x7e5, 0x7dd, 0x7d5, 0x7ce, 0x7c6,
+    0x7bf, 0x7b7, 0x7b0, 0x7a8, 0x7a1, 0x79a, 0x792, 0x78b,
+    0x784, 0x77d, 0x776, 0x76f, 0x768, 0x761, 0x75b, 0x754,
+    0x74d, 0x747, 0x740, 0x739, 0x733, 0x72c, 0x726, 0x720,
+    0x719, 0x713, 0x70d, 0x707, 0x700, 0x6fa, 0x6f4, 0x6ee,
+    0x6e8, 0x6e2, 0x6dc, 0x6d6, 0x6d1, 0x6cb, 0x6c5, 0x6bf,
+    0x6ba, 0x6b4, 0x6ae, 0x6a9, 0x6a3, 0x69e, 0x698, 0x693,
+    0x68d, 0x688, 0x683, 0x67d, 0x678, 0x673, 0x66e, 0x669,
+    0x664, 0x65e, 0x659, 0x654, 0x64f, 0x64a, 0x645, 0x640,
+    0x63c, 0x637, 0x632, 0x62d, 0x628, 0x624, 0x61f, 0x61a,
+    0x616, 0x611, 0x60c, 0x608, 0x603, 0x5ff, 0x5fa, 0x5f6,
+    0x5f1, 0x5ed, 0x5e9, 0x5e4, 0x5e0, 0x5dc, 0x5d7, 0x5d3,
+    0x5cf, 0x5cb, 0x5c6, 0x5c2, 0x5be, 0x5ba, 0x5b6, 0x5b2,
+    0x5ae, 0x5aa, 0x5a6, 0x5a2, 0x59e, 0x59a, 0x596, 0x592,
+    0x58e, 0x58a, 0x586, 0x583, 0x57f, 0x57b, 0x577, 0x574,
+    0x570, 0x56c, 0x568, 0x565, 0x561, 0x55e, 0x55a, 0x556,
+    0x553, 0x54f, 0x54c, 0x548, 0x545, 0x541, 0x53e, 0x53a,
+    0x537, 0x534, 0x530, 0x52d, 0x52a, 0x526, 0x523, 0x520,
+    0x51c, 0x519, 0x516, 0x513, 0x50f, 0x50c, 0x509, 0x506,
+    0x503, 0x500, 0x4fc, 0x4f9, 0x4f6, 0x4f3, 0x4f0, 0x4ed,
+    0x4ea, 0x4e7, 0x4e4, 0x4e1, 0x4de, 0x4db, 0x4d8, 0x4d5,
+    0x4d2, 0x4cf, 0x4cc, 0x4ca, 0x4c7, 0x4c4, 0x4c1, 0x4be,
+    0x4bb, 0x4b9, 0x4b6, 0x4b3, 0x4b0, 0x4ad, 0x4ab, 0x4a8,
+    0x4a5, 0x4a3, 0x4a0, 0x49d, 0x49b, 0x498, 0x495, 0x493,
+    0x490, 0x48d, 0x48b, 0x488, 0x486, 0x483, 0x481, 0x47e,
+    0x47c, 0x479, 0x477, 0x474, 0x472, 0x46f, 0x46d, 0x46a,
+    0x468, 0x465, 0x463, 0x461, 0x45e, 0x45c, 0x459, 0x457,
+    0x455, 0x452, 0x450, 0x44e, 0x44b, 0x449, 0x447, 0x444,
+    0x442, 0x440, 0x43e, 0x43b, 0x439, 0x437, 0x435, 0x432,
+    0x430, 0x42e, 0x42c, 0x42a, 0x428, 0x425, 0x423, 0x421,
+    0x41f, 0x41d, 0x41b, 0x419, 0x417, 0x414, 0x412, 0x410,
+    0x40e, 0x40c, 0x40a, 0x408, 0x406, 0x404, 0x402, 0x400,
+};
+
+// Returns: floor((2^128 - 1) / d) - 2^64 for a normalized d (d >= 2^63).
+// This is Algorithm 2 of the paper: the table estimate is refined by two
+// Newton steps and one Householder step, then adjusted by at most one.
+UNUSED
+static inline du_int reciprocal_word(du_int d) {
+  const du_int d0 = d & 1;
+  const du_int d9 = d >> 55;
+  const du_int d40 = (d >> 24) + 1;
+  const du_int d63 = (d >> 1) + d0;
+  const du_int v0 = reciprocal_table[d9 - 256];
+  const du_int v1 = (v0 << 11) - ((v0 * v0 * d40) >> 40) - 1;
+  const du_int v2 = (v1 << 13) + ((v1 * ((1ULL << 60) - v1 * d40)) >> 47);
+  const du_int e = ((v2 >> 1) & -d0) - v2 * d63;
+  du_int lo;
+  const du_int v3 = (umul64x64to128(v2, e, &lo) >> 1) + (v2 << 31);
+  // v4 = v3 - floor((v3 + 2^64 + 1) * d / 2^64)
+  const du_int hi = umul64x64to128(v3, d, &lo);
+  return v3 - hi - d - (lo + d < lo);
+}
+
+// Returns the 128 bit division result by the normalized 64 bit d, given
+// v = reciprocal_word(d). Result must fit in 64 bits (u1 < d).
+// Remainder stored in r. This is Algorithm 4 of the paper.
+UNUSED
+static inline du_int udiv128by64to64preinv(du_int u1, du_int u0, du_int d,
+                                           du_int v, du_int *r) {
+  du_int q0;
+  du_int q1 = umul64x64to128(v, u1, &q0);
+  q0 += u0;
+  q1 += u1 + (q0 < u0) + 1;
+  du_int rem = u0 - q1 * d;
+  // The first adjustment is taken about half of the time, the second one
+  // rarely.
+  if (rem > q0) {
+    q1 -= 1;
+    rem += d;
+  }
+  if (rem >= d) {
+    q1 += 1;
+    rem -= d;
+  }
+  *r = rem;
+  return q1;
+}
+
+#ifdef CRT_HAS_128BIT
+// Returns the high 128 bits of the full product a * b.
+// The low 128 bits are stored in lo.
+UNUSED
+static inline tu_int umul128x128to256(tu_int a, tu_int b, tu_int *lo) {
+  const du_int a0 = (du_int)a, a1 = (du_int)(a >> 64);
+  const du_int b0 = (du_int)b, b1 = (du_int)(b >> 64);
+  // Each of the component 64x64 -> 128 products
+  const tu_int p00 = (tu_int)a0 * b0;
+  const tu_int p01 = (tu_int)a0 * b1;
+  const tu_int p10 = (tu_int)a1 * b0;
+  const tu_int p11 = (tu_int)a1 * b1;
+  // Sum terms that contribute to lo in a way that allows us to get the carry
+  const tu_int mid = (p00 >> 64) + (du_int)p01 + (du_int)p10;
+  *lo = (mid << 64) | (du_int)p00;
+  // Sum terms contributing to hi with the carry from lo
+  return p11 + (p01 >> 64) + (p10 >> 64) + (mid >> 64);
+}
+#endif // CRT_HAS_128BIT
+
+// Word-sized helpers for the routines that are written once for si, di and
+// ti and customized by COMPUTE_UMULHI and COMPUTE_UDIV2BY1.
+
+// Returns the high word of the full product a * b.
+UNUSED
+static inline su_int umulhisi(su_int a, su_int b) {
+  return (su_int)(((du_int)a * b) >> 32);
+}
+
+UNUSED
+static inline du_int umulhidi(du_int a, du_int b) {
+  du_int lo;
+  return umul64x64to128(a, b, &lo);
+}
+
+#ifdef CRT_HAS_128BIT
+UNUSED
+static inline tu_int umulhiti(tu_int a, tu_int b) {
+  tu_int lo;
+  return umul128x128to256(a, b, &lo);
+}
+#endif // CRT_HAS_128BIT
+
+// Returns: (h * 2^N) / d, where N is the width of the word. Remainder stored
+// in r. Requires h < d so that the quotient fits in one word.
+UNUSED
+static inline su_int udiv2by1si(su_int h, su_int d, su_int *r) {
+  const du_int n = (du_int)h << 32;
+  *r = (su_int)(n % d);
+  return (su_int)(n / d);
+}
+
+UNUSED
+static inline du_int udiv2by1di(du_int h, du_int d, du_int *r) {
+  return udiv128by64to64(h, 0, d, r);
+}
+
+#ifdef CRT_HAS_128BIT
+// Only used while building a divisor descriptor, so a restoring loop is good
+// enough.
+UNUSED
+static inline tu_int udiv2by1ti(tu_int h, tu_int d, tu_int *r) {
+  const unsigned n_utword_bits = sizeof(tu_int) * CHAR_BIT;
+  tu_int q = 0;
+  for (unsigned i = 0; i < n_utword_bits; ++i) {
+    // h < d, so 2 * h + 1 fits in 129 bits; the carry out of h selects the
+    // subtraction when the shifted value no longer fits in tu_int.
+    const tu_int carry = h >> (n_utword_bits - 1);
+    h <<= 1;
+    q <<= 1;
+    if (carry || h >= d) {
+      h -= d;
+      q |= 1;
+    }
+  }
+  *r = h;
+  return q;
+}
+#endif // CRT_HAS_128BIT
+
+#endif // INT_UDIV128_H
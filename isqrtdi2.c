@@ -0,0 +1,25 @@
+//===-- isqrtdi2.c - Implement __isqrtdi2 ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __isqrtdi2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_isqrt.h"
+
+// Returns: floor(sqrt(a))
+
+COMPILER_RT_ABI du_int __isqrtdi2(du_int a) {
+  if (a == 0)
+    return 0;
+  // Scale a by an even power of two into [2^62, 2^64); the root scales by
+  // half of it.
+  const int shift = __builtin_clzll(a) & ~1;
+  return isqrt64norm(a << shift) >> (shift / 2);
+}
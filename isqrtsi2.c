@@ -0,0 +1,25 @@
+//===-- isqrtsi2.c - Implement __isqrtsi2 ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __isqrtsi2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_isqrt.h"
+
+// Returns: floor(sqrt(a))
+
+COMPILER_RT_ABI su_int __isqrtsi2(su_int a) {
+  if (a == 0)
+    return 0;
+  // Scale a by an even power of two into [2^30, 2^32); the root scales by
+  // half of it.
+  const int shift = clzsi(a) & ~1;
+  return isqrt32norm(a << shift) >> (shift / 2);
+}
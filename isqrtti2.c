@@ -0,0 +1,44 @@
+//===-- isqrtti2.c - Implement __isqrtti2 ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __isqrtti2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+#include "int_isqrt.h"
+#include "int_udiv128.h"
+
+// Returns: floor(sqrt(a))
+
+COMPILER_RT_ABI tu_int __isqrtti2(tu_int a) {
+  if (a == 0)
+    return 0;
+  // Scale a by an even power of two into [2^126, 2^128); the root scales by
+  // half of it.
+  const int shift = __clzti2(a) & ~1;
+  const tu_int m = a << shift;
+  // The root of the high word gives the top half of the root, s <= sqrt(m)
+  // within 2^32. One Newton step s + (m - s^2) / (2 s) from below lands on
+  // floor(sqrt(m)) or one above it. The quotient fits in 64 bits and
+  // (m - s^2) / 2 < s * 2^64, so it is a single 128 by 64 bit division.
+  const du_int s = isqrt64norm((du_int)(m >> 64)) << 32;
+  const tu_int e = (m - (tu_int)s * s) >> 1;
+  du_int r;
+  tu_int t = s + (tu_int)udiv128by64to64((du_int)(e >> 64), (du_int)e, s, &r);
+  if (t > ~(du_int)0)
+    t = ~(du_int)0;
+  if (t * t > m)
+    --t;
+  return t >> (shift / 2);
+}
+
+#endif // CRT_HAS_128BIT
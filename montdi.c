@@ -0,0 +1,93 @@
+//===-- montdi.c - Implement Montgomery multiplication --------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements multiplication modulo an odd 64 bit modulus in
+// Montgomery form (REDC) for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+// Returns: a * b * 2^-64 mod ctx->modulus
+// Precondition:  a * b < modulus * 2^64, e.g. a, b < modulus
+static __inline du_int redc(du_int a, du_int b, const du_montgomery *ctx) {
+  du_int low;
+  const du_int high = umul64x64to128(a, b, &low);
+  // With u = low * modulus^-1, u * modulus has the same low word as a * b,
+  // so their difference is a multiple of 2^64 and only the high words need
+  // to be subtracted.
+  du_int um_low;
+  const du_int um_high = umul64x64to128(low * ctx->inverse, ctx->modulus,
+                                        &um_low);
+  const du_int r = high - um_high;
+  return high < um_high ? r + ctx->modulus : r;
+}
+
+// Effects: prepares *ctx for arithmetic modulo m
+// m must be odd.
+
+COMPILER_RT_ABI void __montdi_init(du_montgomery *ctx, du_int m) {
+  // (3 * m) ^ 2 is an inverse of m modulo 2^5; each Newton step doubles the
+  // number of correct bits.
+  du_int inverse = (3 * m) ^ 2;
+  for (int i = 0; i < 4; ++i)
+    inverse *= 2 - m * inverse;
+  ctx->modulus = m;
+  ctx->inverse = inverse;
+  ctx->r1 = -m % m;
+  du_int low;
+  const du_int high = umul64x64to128(ctx->r1, ctx->r1, &low);
+  udiv128by64to64(high, low, m, &ctx->r2);
+}
+
+// Returns: a * 2^64 mod m, the Montgomery form of a
+
+COMPILER_RT_ABI du_int __tomontdi2(du_int a, const du_montgomery *ctx) {
+  return redc(a, ctx->r2, ctx);
+}
+
+// Returns: a * 2^-64 mod m, the ordinary residue of the Montgomery form a
+
+COMPILER_RT_ABI du_int __frommontdi2(du_int a, const du_montgomery *ctx) {
+  return redc(a, 1, ctx);
+}
+
+// Returns: the Montgomery form of the product of the Montgomery forms a and b
+// Precondition:  a, b < m
+
+COMPILER_RT_ABI du_int __montmuldi3(du_int a, du_int b,
+                                    const du_montgomery *ctx) {
+  return redc(a, b, ctx);
+}
+
+// Effects: r[i] = __montmuldi3(a[i], b[i], ctx) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __montmuldi3_n(du_int *r, const du_int *a, const du_int *b,
+                                    size_t n, const du_montgomery *ctx) {
+  const du_montgomery c = *ctx;
+  for (size_t i = 0; i < n; ++i)
+    r[i] = redc(a[i], b[i], &c);
+}
+
+// Returns: a^e mod m, with a and the result ordinary residues
+
+COMPILER_RT_ABI du_int __montpowdi3(du_int a, du_int e,
+                                    const du_montgomery *ctx) {
+  const du_montgomery c = *ctx;
+  const du_int x = redc(a, c.r2, &c);
+  du_int result = c.r1;
+  // Left to right square and multiply.
+  for (int i = e ? 63 - __builtin_clzll(e) : -1; i >= 0; --i) {
+    result = redc(result, result, &c);
+    if ((e >> i) & 1)
+      result = redc(result, x, &c);
+  }
+  return redc(result, 1, &c);
+}
@@ -0,0 +1,59 @@
+//===-- mpnadd.c - Implement __crt_mpn_add_n and __crt_mpn_sub_n ----------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements multi-limb addition and subtraction for the
+// compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+// Natural numbers are arrays of n 64 bit limbs, least significant first,
+// as in GMP's mpn layer. n may be 0 and r may be the same array as a or b.
+
+// Effects: r = a + b
+// Returns: the carry out of the most significant limb
+
+COMPILER_RT_ABI du_int __crt_mpn_add_n(du_int *r, const du_int *a,
+                                       const du_int *b, size_t n) {
+  unsigned char carry = 0;
+  for (size_t i = 0; i < n; ++i) {
+#if defined(__x86_64__)
+    unsigned long long sum;
+    carry = __builtin_ia32_addcarryx_u64(carry, a[i], b[i], &sum);
+    r[i] = sum;
+#else
+    const du_int sum = a[i] + b[i];
+    const unsigned char carry_sum = sum < a[i];
+    r[i] = sum + carry;
+    carry = carry_sum | (r[i] < carry);
+#endif
+  }
+  return carry;
+}
+
+// Effects: r = a - b
+// Returns: the borrow out of the most significant limb
+
+COMPILER_RT_ABI du_int __crt_mpn_sub_n(du_int *r, const du_int *a,
+                                       const du_int *b, size_t n) {
+  unsigned char borrow = 0;
+  for (size_t i = 0; i < n; ++i) {
+#if defined(__x86_64__)
+    unsigned long long difference;
+    borrow = __builtin_ia32_sbb_u64(borrow, a[i], b[i], &difference);
+    r[i] = difference;
+#else
+    const du_int difference = a[i] - b[i];
+    const unsigned char borrow_difference = a[i] < b[i];
+    r[i] = difference - borrow;
+    borrow = borrow_difference | (difference < borrow);
+#endif
+  }
+  return borrow;
+}
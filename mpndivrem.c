@@ -0,0 +1,65 @@
+//===-- mpndivrem.c - Implement __crt_mpn_divrem_1 ------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements division of a multi-limb number by one limb for the
+// compiler_rt library. Each limb costs a multiply-based division by a
+// precomputed reciprocal instead of a hardware division.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+// Returns: floor((2^128 - 1) / d) - 2^64, the reciprocal used by
+// __crt_mpn_divrem_1_preinv
+// Precondition:  d >= 2^63
+
+COMPILER_RT_ABI du_int __crt_mpn_invert_limb(du_int d) {
+  return reciprocal_word(d);
+}
+
+// Effects: q = a / d, over n limbs
+// Returns: a % d
+// dinv must be __crt_mpn_invert_limb(d << __builtin_clzll(d)). d == 0 cases
+// are undefined. q may be the same array as a.
+
+COMPILER_RT_ABI du_int __crt_mpn_divrem_1_preinv(du_int *q, const du_int *a,
+                                                 size_t n, du_int d,
+                                                 du_int dinv) {
+  const unsigned bits_in_dword = sizeof(du_int) * CHAR_BIT;
+  if (n == 0)
+    return 0;
+  // Divide a * 2^shift by the normalized divisor; the quotient is the same
+  // and the remainder is scaled by 2^shift.
+  const unsigned shift = __builtin_clzll(d);
+  const du_int dn = d << shift;
+  du_int r;
+  if (shift == 0) {
+    r = 0;
+    for (size_t i = n; i-- > 0;)
+      q[i] = udiv128by64to64preinv(r, a[i], dn, dinv, &r);
+    return r;
+  }
+  r = a[n - 1] >> (bits_in_dword - shift);
+  for (size_t i = n - 1; i > 0; --i) {
+    const du_int u = (a[i] << shift) | (a[i - 1] >> (bits_in_dword - shift));
+    q[i] = udiv128by64to64preinv(r, u, dn, dinv, &r);
+  }
+  q[0] = udiv128by64to64preinv(r, a[0] << shift, dn, dinv, &r);
+  return r >> shift;
+}
+
+// Effects: q = a / d, over n limbs
+// Returns: a % d
+// d == 0 cases are undefined. q may be the same array as a.
+
+COMPILER_RT_ABI du_int __crt_mpn_divrem_1(du_int *q, const du_int *a, size_t n,
+                                          du_int d) {
+  return __crt_mpn_divrem_1_preinv(
+      q, a, n, d, reciprocal_word(d << __builtin_clzll(d)));
+}
@@ -0,0 +1,177 @@
+//===-- mpnmul.c - Implement __crt_mpn_mul_1 and friends ------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements multiplication of a multi-limb number by one limb
+// for the compiler_rt library: __crt_mpn_mul_1, __crt_mpn_addmul_1 and
+// __crt_mpn_submul_1.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+#include "int_udiv128.h"
+
+// Natural numbers are arrays of n 64 bit limbs, least significant first.
+// r may be the same array as a, but must not overlap it otherwise.
+
+#if defined(__x86_64__)
+
+#define CRT_CPU_MULX_ADX (CRT_CPU_BMI2 | CRT_CPU_ADX)
+
+// The loops below keep their carries in CF (adcx) and OF (adox), so the loop
+// counter lives in rcx and is stepped with lea and tested with jrcxz, which
+// leave the flags alone. mulx takes its second factor from rdx.
+// Precondition:  n >= 1
+
+static du_int mul_1_adx(du_int *r, const du_int *a, size_t n, du_int b) {
+  du_int carry, low, high;
+  __asm__("xor %k[carry], %k[carry]\n\t"
+          "1:\n\t"
+          "mulx (%[a]), %[low], %[high]\n\t"
+          "adcx %[carry], %[low]\n\t"
+          "mov %[low], (%[r])\n\t"
+          "mov %[high], %[carry]\n\t"
+          "lea 8(%[a]), %[a]\n\t"
+          "lea 8(%[r]), %[r]\n\t"
+          "lea -1(%[n]), %[n]\n\t"
+          "jrcxz 2f\n\t"
+          "jmp 1b\n"
+          "2:\n\t"
+          "mov $0, %k[low]\n\t"
+          "adcx %[low], %[carry]"
+          : [carry] "=&r"(carry), [low] "=&r"(low), [high] "=&r"(high),
+            [a] "+r"(a), [r] "+r"(r), [n] "+c"(n)
+          : "d"(b)
+          : "cc", "memory");
+  return carry;
+}
+
+// Two carry chains: adcx adds the previous high word to the low word of the
+// product, adox adds that to r[i].
+static du_int addmul_1_adx(du_int *r, const du_int *a, size_t n, du_int b) {
+  du_int carry, low, high;
+  __asm__("xor %k[carry], %k[carry]\n\t"
+          "1:\n\t"
+          "mulx (%[a]), %[low], %[high]\n\t"
+          "adcx %[carry], %[low]\n\t"
+          "adox (%[r]), %[low]\n\t"
+          "mov %[low], (%[r])\n\t"
+          "mov %[high], %[carry]\n\t"
+          "lea 8(%[a]), %[a]\n\t"
+          "lea 8(%[r]), %[r]\n\t"
+          "lea -1(%[n]), %[n]\n\t"
+          "jrcxz 2f\n\t"
+          "jmp 1b\n"
+          "2:\n\t"
+          "mov $0, %k[low]\n\t"
+          "adcx %[low], %[carry]\n\t"
+          "adox %[low], %[carry]"
+          : [carry] "=&r"(carry), [low] "=&r"(low), [high] "=&r"(high),
+            [a] "+r"(a), [r] "+r"(r), [n] "+c"(n)
+          : "d"(b)
+          : "cc", "memory");
+  return carry;
+}
+
+// There is no subtracting form of adox, so r[i] - t - borrow is computed as
+// ~(~r[i] + t + borrow), whose carry out is exactly the borrow out.
+static du_int submul_1_adx(du_int *r, const du_int *a, size_t n, du_int b) {
+  du_int carry, low, high, t;
+  __asm__("xor %k[carry], %k[carry]\n\t"
+          "1:\n\t"
+          "mulx (%[a]), %[low], %[high]\n\t"
+          "adcx %[carry], %[low]\n\t"
+          "mov (%[r]), %[t]\n\t"
+          "not %[t]\n\t"
+          "adox %[low], %[t]\n\t"
+          "not %[t]\n\t"
+          "mov %[t], (%[r])\n\t"
+          "mov %[high], %[carry]\n\t"
+          "lea 8(%[a]), %[a]\n\t"
+          "lea 8(%[r]), %[r]\n\t"
+          "lea -1(%[n]), %[n]\n\t"
+          "jrcxz 2f\n\t"
+          "jmp 1b\n"
+          "2:\n\t"
+          "mov $0, %k[low]\n\t"
+          "adcx %[low], %[carry]\n\t"
+          "adox %[low], %[carry]"
+          : [carry] "=&r"(carry), [low] "=&r"(low), [high] "=&r"(high),
+            [t] "=&r"(t), [a] "+r"(a), [r] "+r"(r), [n] "+c"(n)
+          : "d"(b)
+          : "cc", "memory");
+  return carry;
+}
+
+#endif // defined(__x86_64__)
+
+// Effects: r = a * b
+// Returns: the most significant limb of the product
+
+COMPILER_RT_ABI du_int __crt_mpn_mul_1(du_int *r, const du_int *a, size_t n,
+                                       du_int b) {
+#if defined(__x86_64__)
+  if (n && (crt_cpu_features() & CRT_CPU_MULX_ADX) == CRT_CPU_MULX_ADX)
+    return mul_1_adx(r, a, n, b);
+#endif
+  du_int carry = 0;
+  for (size_t i = 0; i < n; ++i) {
+    du_int low;
+    du_int high = umul64x64to128(a[i], b, &low);
+    low += carry;
+    high += low < carry;
+    r[i] = low;
+    carry = high;
+  }
+  return carry;
+}
+
+// Effects: r = r + a * b, over n limbs
+// Returns: the carry limb out of the most significant limb
+
+COMPILER_RT_ABI du_int __crt_mpn_addmul_1(du_int *r, const du_int *a,
+                                          size_t n, du_int b) {
+#if defined(__x86_64__)
+  if (n && (crt_cpu_features() & CRT_CPU_MULX_ADX) == CRT_CPU_MULX_ADX)
+    return addmul_1_adx(r, a, n, b);
+#endif
+  du_int carry = 0;
+  for (size_t i = 0; i < n; ++i) {
+    du_int low;
+    du_int high = umul64x64to128(a[i], b, &low);
+    low += carry;
+    high += low < carry;
+    const du_int sum = r[i] + low;
+    high += sum < low;
+    r[i] = sum;
+    carry = high;
+  }
+  return carry;
+}
+
+// Effects: r = r - a * b, over n limbs
+// Returns: the borrow limb out of the most significant limb
+
+COMPILER_RT_ABI du_int __crt_mpn_submul_1(du_int *r, const du_int *a,
+                                          size_t n, du_int b) {
+#if defined(__x86_64__)
+  if (n && (crt_cpu_features() & CRT_CPU_MULX_ADX) == CRT_CPU_MULX_ADX)
+    return submul_1_adx(r, a, n, b);
+#endif
+  du_int borrow = 0;
+  for (size_t i = 0; i < n; ++i) {
+    du_int low;
+    du_int high = umul64x64to128(a[i], b, &low);
+    low += borrow;
+    high += low < borrow;
+    high += r[i] < low;
+    r[i] -= low;
+    borrow = high;
+  }
+  return borrow;
+}
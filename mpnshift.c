@@ -0,0 +1,44 @@
+//===-- mpnshift.c - Implement __crt_mpn_lshift and __crt_mpn_rshift ------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements multi-limb shifts for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+// Effects: r = a << cnt, over n limbs
+// Returns: the bits shifted out of the most significant limb, in the low
+// cnt bits
+// Precondition:  n >= 1 and 1 <= cnt < 64; r may overlap a if r >= a
+
+COMPILER_RT_ABI du_int __crt_mpn_lshift(du_int *r, const du_int *a, size_t n,
+                                        unsigned cnt) {
+  const unsigned bits_in_dword = sizeof(du_int) * CHAR_BIT;
+  const du_int out = a[n - 1] >> (bits_in_dword - cnt);
+  // Work downwards so that a shift into a higher address is safe.
+  for (size_t i = n - 1; i > 0; --i)
+    r[i] = (a[i] << cnt) | (a[i - 1] >> (bits_in_dword - cnt));
+  r[0] = a[0] << cnt;
+  return out;
+}
+
+// Effects: r = a >> cnt, over n limbs
+// Returns: the bits shifted out of the least significant limb, in the high
+// cnt bits
+// Precondition:  n >= 1 and 1 <= cnt < 64; r may overlap a if r <= a
+
+COMPILER_RT_ABI du_int __crt_mpn_rshift(du_int *r, const du_int *a, size_t n,
+                                        unsigned cnt) {
+  const unsigned bits_in_dword = sizeof(du_int) * CHAR_BIT;
+  const du_int out = a[0] << (bits_in_dword - cnt);
+  for (size_t i = 0; i < n - 1; ++i)
+    r[i] = (a[i] >> cnt) | (a[i + 1] << (bits_in_dword - cnt));
+  r[n - 1] = a[n - 1] >> cnt;
+  return out;
+}
@@ -10,8 +10,12 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "int_lib.h"
+#include "int_udiv128.h"
+
 #define fixint_t di_int
 #define fixuint_t du_int
+#define COMPUTE_UMULHI(a, b) umulhidi((a), (b))
 #include "int_mulo_impl.inc"
 
 // Returns: a * b
@@ -0,0 +1,30 @@
+//===-- muloi3.c - Implement __muloi3 -------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __muloi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: a * b
+
+COMPILER_RT_ABI oi_int __muloi3(oi_int a, oi_int b) {
+  tu_int low;
+  tu_int high = umul128x128to256(a.low, b.low, &low);
+  high += (tu_int)a.high * b.low + a.low * (tu_int)b.high;
+  oi_int r;
+  r.low = low;
+  r.high = (ti_int)high;
+  return r;
+}
+
+#endif // CRT_HAS_128BIT
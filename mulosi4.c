@@ -12,6 +12,7 @@
 
 #define fixint_t si_int
 #define fixuint_t su_int
+#define COMPUTE_UMULHI(a, b) ((su_int)(((du_int)(a) * (b)) >> 32))
 #include "int_mulo_impl.inc"
 
 // Returns: a * b
@@ -14,12 +14,15 @@
 
 #ifdef CRT_HAS_128BIT
 
+#include "int_udiv128.h"
+
 // Returns: a * b
 
 // Effects: sets *overflow to 1  if a * b overflows
 
 #define fixint_t ti_int
 #define fixuint_t tu_int
+#define COMPUTE_UMULHI(a, b) umulhiti((a), (b))
 #include "int_mulo_impl.inc"
 
 COMPILER_RT_ABI ti_int __muloti4(ti_int a, ti_int b, int *overflow) {
@@ -0,0 +1,45 @@
+//===-- lib/mulsf3_round.c - Single-precision directed multiply ---*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements single-precision soft-float multiplication rounded
+// toward zero, downward and upward, whatever the current mode, and rounded
+// both downward and upward by a single call for interval arithmetic.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define SINGLE_PRECISION
+#include "fp_mul_impl.inc"
+
+COMPILER_RT_ABI fp_t __mulsf3_rz(fp_t a, fp_t b) {
+  return __mulXf3_round__(a, b, CRT_FE_TOWARDZERO);
+}
+
+COMPILER_RT_ABI fp_t __mulsf3_rd(fp_t a, fp_t b) {
+  return __mulXf3_round__(a, b, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI fp_t __mulsf3_ru(fp_t a, fp_t b) {
+  return __mulXf3_round__(a, b, CRT_FE_UPWARD);
+}
+
+// Both bounds at once, from a single product.
+
+COMPILER_RT_ABI void __mulsf3_bounds(fp_t a, fp_t b, fp_t *lo, fp_t *hi) {
+  __mulXf3_bounds__(a, b, lo, hi);
+}
+
+// The product of the intervals [alo, ahi] and [blo, bhi], rounded outward.
+
+COMPILER_RT_ABI void __mulsf3_interval(fp_t alo, fp_t ahi, fp_t blo, fp_t bhi,
+                                       fp_t *lo, fp_t *hi) {
+  __mulXf3_interval__(alo, ahi, blo, bhi, lo, hi);
+}
+
+#endif
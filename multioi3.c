@@ -0,0 +1,33 @@
+//===-- multioi3.c - Implement __multioi3 ---------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __multioi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: the full 256 bit product a * b
+
+COMPILER_RT_ABI oi_int __multioi3(ti_int a, ti_int b) {
+  const int N = (int)(sizeof(ti_int) * CHAR_BIT) - 1;
+  tu_int low;
+  tu_int high = umul128x128to256((tu_int)a, (tu_int)b, &low);
+  // The unsigned product counts a negative operand as x + 2^128, which adds
+  // the other operand times 2^128 to the result.
+  high -= ((tu_int)(a >> N) & (tu_int)b) + ((tu_int)(b >> N) & (tu_int)a);
+  oi_int r;
+  r.low = low;
+  r.high = (ti_int)high;
+  return r;
+}
+
+#endif // CRT_HAS_128BIT
@@ -0,0 +1,56 @@
+//===-- pdepdi2.c - Implement __pdepdi2 -----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __pdepdi2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+
+#if defined(__x86_64__)
+
+static __attribute__((__target__("bmi2"))) du_int pdep_bmi2(du_int a,
+                                                             du_int mask) {
+  return __builtin_ia32_pdep_di(a, mask);
+}
+
+#endif // defined(__x86_64__)
+
+// Returns: the low bits of a, in order, deposited at the set bits of mask;
+// the other bits are clear (the x86 pdep instruction)
+
+COMPILER_RT_ABI du_int __pdepdi2(du_int a, du_int mask) {
+#if defined(__x86_64__)
+  if ((crt_cpu_features() & (CRT_CPU_BMI2 | CRT_CPU_SLOW_PDEP)) ==
+      CRT_CPU_BMI2)
+    return pdep_bmi2(a, mask);
+#endif
+  // The inverse of __pextdi2: the distances are found the same way, then the
+  // bits move left by 32, 16, ... 1 positions, undoing the pext steps in
+  // reverse order. See Hacker's Delight, 2nd edition, section 7-5.
+  const du_int m = mask;
+  du_int moved[6];
+  du_int below = ~mask << 1;
+  for (int i = 0; i < 6; ++i) {
+    du_int moves = below ^ (below << 1);
+    moves ^= moves << 2;
+    moves ^= moves << 4;
+    moves ^= moves << 8;
+    moves ^= moves << 16;
+    moves ^= moves << 32;
+    moved[i] = moves & mask;
+    mask = (mask ^ moved[i]) | (moved[i] >> (1 << i));
+    below &= ~moves;
+  }
+  for (int i = 5; i >= 0; --i) {
+    const du_int t = a << (1 << i);
+    a = (a & ~moved[i]) | (t & moved[i]);
+  }
+  return a & m;
+}
@@ -0,0 +1,58 @@
+//===-- pextdi2.c - Implement __pextdi2 -----------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __pextdi2 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+
+#if defined(__x86_64__)
+
+static __attribute__((__target__("bmi2"))) du_int pext_bmi2(du_int a,
+                                                             du_int mask) {
+  return __builtin_ia32_pext_di(a, mask);
+}
+
+#endif // defined(__x86_64__)
+
+// Returns: the bits of a selected by mask, packed into the low bits of the
+// result in order (the x86 pext instruction)
+
+COMPILER_RT_ABI du_int __pextdi2(du_int a, du_int mask) {
+#if defined(__x86_64__)
+  if ((crt_cpu_features() & (CRT_CPU_BMI2 | CRT_CPU_SLOW_PDEP)) ==
+      CRT_CPU_BMI2)
+    return pext_bmi2(a, mask);
+#endif
+  // Every selected bit moves right by the number of clear mask bits below
+  // it. Those distances are written in binary and the bits are moved by 1,
+  // 2, 4, ... 32 positions in turn, so the cost does not depend on the mask.
+  // See Hacker's Delight, 2nd edition, section 7-4.
+  a &= mask;
+  // below starts as the clear mask bits moved up one place, so that its
+  // prefix parity at bit k is bit 0 of the distance of bit k. Each step
+  // leaves in it what gives the next bit of the distances.
+  du_int below = ~mask << 1;
+  for (int i = 0; i < 6; ++i) {
+    // Bit k of moves is bit i of the distance of bit k.
+    du_int moves = below ^ (below << 1);
+    moves ^= moves << 2;
+    moves ^= moves << 4;
+    moves ^= moves << 8;
+    moves ^= moves << 16;
+    moves ^= moves << 32;
+    const du_int moved = moves & mask;
+    mask = (mask ^ moved) | (moved >> (1 << i));
+    const du_int t = a & moved;
+    a = (a ^ t) | (t >> (1 << i));
+    below &= ~moves;
+  }
+  return a;
+}
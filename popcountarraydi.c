@@ -0,0 +1,277 @@
+//===-- popcountarraydi.c - Implement __popcountdi2_n and friends ---------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements population count and parity over arrays of 64 bit
+// words for the compiler_rt library. __popcountanddi3_n, __popcountordi3_n
+// and __popcountxordi3_n count the bits of two arrays combined word by word
+// without materializing the combination.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_cpu.h"
+
+// The combined routines count the bits of a[i] op b[i]. The kernels take the
+// operation as a constant, so the selection in LOAD_OP folds away.
+enum { OP_NONE, OP_AND, OP_OR, OP_XOR };
+
+// Returns: x op y, or x for OP_NONE
+#define LOAD_OP(x, y, op)                                                      \
+  ((op) == OP_AND  ? (x) & (y)                                                 \
+   : (op) == OP_OR ? (x) | (y)                                                 \
+   : (op) == OP_XOR ? (x) ^ (y)                                                \
+                    : (x))
+
+// Carry-save adder: for every bit position, h:l = a + b + c.
+#define CSA(h, l, a, b, c)                                                     \
+  do {                                                                         \
+    const __typeof__(a) a_ = (a), b_ = (b), c_ = (c);                          \
+    const __typeof__(a) u_ = a_ ^ b_;                                          \
+    (h) = (a_ & b_) | (u_ & c_);                                               \
+    (l) = u_ ^ c_;                                                             \
+  } while (0)
+
+// Harley-Seal: adds the 16 words w(0) .. w(15) into the bit-slice counters
+// ones, twos, fours and eights through a tree of carry-save adders, leaving
+// the carry of weight 16 in sixteens. Only sixteens then needs a population
+// count, once per 16 words. See W. Mula, N. Kurz and D. Lemire, "Faster
+// population counts using AVX2 instructions", The Computer Journal, 2018.
+#define HARLEY_SEAL_16(T, w)                                                   \
+  do {                                                                         \
+    T twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;                    \
+    CSA(twos_a, ones, ones, w(0), w(1));                                       \
+    CSA(twos_b, ones, ones, w(2), w(3));                                       \
+    CSA(fours_a, twos, twos, twos_a, twos_b);                                  \
+    CSA(twos_a, ones, ones, w(4), w(5));                                       \
+    CSA(twos_b, ones, ones, w(6), w(7));                                       \
+    CSA(fours_b, twos, twos, twos_a, twos_b);                                  \
+    CSA(eights_a, fours, fours, fours_a, fours_b);                             \
+    CSA(twos_a, ones, ones, w(8), w(9));                                       \
+    CSA(twos_b, ones, ones, w(10), w(11));                                     \
+    CSA(fours_a, twos, twos, twos_a, twos_b);                                  \
+    CSA(twos_a, ones, ones, w(12), w(13));                                     \
+    CSA(twos_b, ones, ones, w(14), w(15));                                     \
+    CSA(fours_b, twos, twos, twos_a, twos_b);                                  \
+    CSA(eights_b, fours, fours, fours_a, fours_b);                             \
+    CSA(sixteens, eights, eights, eights_a, eights_b);                         \
+  } while (0)
+
+// Returns: the number of 1 bits in a[i] op b[i] for i < n
+// Harley-Seal on words, counting with the SWAR code of __popcountdi2.
+static __inline ALWAYS_INLINE du_int
+popcount_words(const du_int *a, const du_int *b, size_t n, int op) {
+  du_int total = 0;
+  du_int ones = 0, twos = 0, fours = 0, eights = 0, sixteens;
+  size_t i = 0;
+#define WORD(k) LOAD_OP(a[i + (k)], b[i + (k)], op)
+  for (; n - i >= 16; i += 16) {
+    HARLEY_SEAL_16(du_int, WORD);
+    total += __popcountdi2(sixteens);
+  }
+#undef WORD
+  total = 16 * total + 8 * (du_int)__popcountdi2(eights) +
+          4 * (du_int)__popcountdi2(fours) + 2 * (du_int)__popcountdi2(twos) +
+          __popcountdi2(ones);
+  for (; i < n; ++i)
+    total += __popcountdi2(LOAD_OP(a[i], b[i], op));
+  return total;
+}
+
+#ifdef CRT_HAS_X86_VECTOR
+
+typedef du_int v4du __attribute__((__vector_size__(32)));
+typedef char v32qi __attribute__((__vector_size__(32)));
+typedef du_int v8du __attribute__((__vector_size__(64)));
+typedef long long v8di __attribute__((__vector_size__(64)));
+
+#define AVX2 __attribute__((__target__("avx2")))
+#define AVX512_VPOPCNTDQ __attribute__((__target__("avx512f,avx512vpopcntdq")))
+
+#ifdef __clang__
+#define VPOPCNTQ(x) ((v8du)__builtin_ia32_vpopcntq_512((v8di)(x)))
+#else
+#define VPOPCNTQ(x) ((v8du)__builtin_ia32_vpopcountq_v8di((v8di)(x)))
+#endif
+
+static __inline ALWAYS_INLINE AVX2 v4du load_avx2(const du_int *p) {
+  v4du v;
+  __builtin_memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// Returns: the population count of each 64 bit lane of v.
+// vpshufb looks up the count of each nibble and vpsadbw adds up the eight
+// byte counts of every lane.
+static __inline ALWAYS_INLINE AVX2 v4du popcount_avx2(v4du v) {
+  const v32qi table = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                       0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+  const v32qi lo = (v32qi)(v & 0x0F0F0F0F0F0F0F0FULL);
+  const v32qi hi = (v32qi)((v >> 4) & 0x0F0F0F0F0F0F0F0FULL);
+  const v32qi counts = __builtin_ia32_pshufb256(table, lo) +
+                       __builtin_ia32_pshufb256(table, hi);
+  return (v4du)__builtin_ia32_psadbw256(counts, (v32qi){});
+}
+
+// Returns: the number of 1 bits in a[i] op b[i] for i < n, n a multiple of
+// 64
+// Harley-Seal on ymm registers.
+static __inline ALWAYS_INLINE AVX2 du_int
+popcount_avx2_op(const du_int *a, const du_int *b, size_t n, int op) {
+  v4du total = {};
+  v4du ones = {}, twos = {}, fours = {}, eights = {}, sixteens;
+#define WORD(k)                                                                \
+  LOAD_OP(load_avx2(a + i + 4 * (k)), load_avx2(b + i + 4 * (k)), op)
+  for (size_t i = 0; i < n; i += 64) {
+    HARLEY_SEAL_16(v4du, WORD);
+    total += popcount_avx2(sixteens);
+  }
+#undef WORD
+  total = 16 * total + 8 * popcount_avx2(eights) + 4 * popcount_avx2(fours) +
+          2 * popcount_avx2(twos) + popcount_avx2(ones);
+  return total[0] + total[1] + total[2] + total[3];
+}
+
+static AVX2 du_int popcount_avx2_n(const du_int *a, const du_int *b, size_t n,
+                                   int op) {
+  switch (op) {
+  case OP_AND:
+    return popcount_avx2_op(a, b, n, OP_AND);
+  case OP_OR:
+    return popcount_avx2_op(a, b, n, OP_OR);
+  case OP_XOR:
+    return popcount_avx2_op(a, b, n, OP_XOR);
+  default:
+    return popcount_avx2_op(a, b, n, OP_NONE);
+  }
+}
+
+static __inline ALWAYS_INLINE AVX512_VPOPCNTDQ v8du
+load_avx512(const du_int *p) {
+  v8du v;
+  __builtin_memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// Returns: the number of 1 bits in a[i] op b[i] for i < n, n a multiple of
+// 32
+// vpopcntq counts every lane directly; four accumulators hide its latency.
+static __inline ALWAYS_INLINE AVX512_VPOPCNTDQ du_int
+popcount_avx512_op(const du_int *a, const du_int *b, size_t n, int op) {
+  v8du t0 = {}, t1 = {}, t2 = {}, t3 = {};
+#define WORD(k)                                                                \
+  LOAD_OP(load_avx512(a + i + 8 * (k)), load_avx512(b + i + 8 * (k)), op)
+  for (size_t i = 0; i < n; i += 32) {
+    t0 += VPOPCNTQ(WORD(0));
+    t1 += VPOPCNTQ(WORD(1));
+    t2 += VPOPCNTQ(WORD(2));
+    t3 += VPOPCNTQ(WORD(3));
+  }
+#undef WORD
+  const v8du t = (t0 + t1) + (t2 + t3);
+  return t[0] + t[1] + t[2] + t[3] + t[4] + t[5] + t[6] + t[7];
+}
+
+static AVX512_VPOPCNTDQ du_int popcount_avx512_n(const du_int *a,
+                                                 const du_int *b, size_t n,
+                                                 int op) {
+  switch (op) {
+  case OP_AND:
+    return popcount_avx512_op(a, b, n, OP_AND);
+  case OP_OR:
+    return popcount_avx512_op(a, b, n, OP_OR);
+  case OP_XOR:
+    return popcount_avx512_op(a, b, n, OP_XOR);
+  default:
+    return popcount_avx512_op(a, b, n, OP_NONE);
+  }
+}
+
+// Returns: the exclusive or of a[i] for i < n, n a multiple of 8
+static AVX2 du_int xor_avx2(const du_int *a, size_t n) {
+  v4du x0 = {}, x1 = {};
+  for (size_t i = 0; i < n; i += 8) {
+    x0 ^= load_avx2(a + i);
+    x1 ^= load_avx2(a + i + 4);
+  }
+  x0 ^= x1;
+  return x0[0] ^ x0[1] ^ x0[2] ^ x0[3];
+}
+
+#endif // CRT_HAS_X86_VECTOR
+
+// Returns: the number of 1 bits in a[i] op b[i] for i < n
+static __inline ALWAYS_INLINE du_int popcount(const du_int *a,
+                                              const du_int *b, size_t n,
+                                              int op) {
+  du_int total = 0;
+#ifdef CRT_HAS_X86_VECTOR
+  const su_int features = crt_cpu_features();
+  size_t done = 0;
+  if (features & CRT_CPU_AVX512_VPOPCNTDQ) {
+    done = n & ~(size_t)31;
+    total = popcount_avx512_n(a, b, done, op);
+  } else if (features & CRT_CPU_AVX2) {
+    done = n & ~(size_t)63;
+    total = popcount_avx2_n(a, b, done, op);
+  }
+  a += done;
+  b += done;
+  n -= done;
+#endif
+  return total + popcount_words(a, b, n, op);
+}
+
+// Returns: count of 1 bits in a[0] .. a[n - 1]
+
+COMPILER_RT_ABI du_int __popcountdi2_n(const du_int *a, size_t n) {
+  return popcount(a, a, n, OP_NONE);
+}
+
+// Returns: count of 1 bits in a[i] & b[i] for i < n
+
+COMPILER_RT_ABI du_int __popcountanddi3_n(const du_int *a, const du_int *b,
+                                          size_t n) {
+  return popcount(a, b, n, OP_AND);
+}
+
+// Returns: count of 1 bits in a[i] | b[i] for i < n
+
+COMPILER_RT_ABI du_int __popcountordi3_n(const du_int *a, const du_int *b,
+                                         size_t n) {
+  return popcount(a, b, n, OP_OR);
+}
+
+// Returns: count of 1 bits in a[i] ^ b[i] for i < n
+
+COMPILER_RT_ABI du_int __popcountxordi3_n(const du_int *a, const du_int *b,
+                                          size_t n) {
+  return popcount(a, b, n, OP_XOR);
+}
+
+// Returns: 1 if the number of 1 bits in a[0] .. a[n - 1] is odd else 0
+
+COMPILER_RT_ABI int __paritydi2_n(const du_int *a, size_t n) {
+  // The parity of the buffer is that of the exclusive or of its words.
+  du_int x0 = 0, x1 = 0, x2 = 0, x3 = 0;
+  size_t i = 0;
+#ifdef CRT_HAS_X86_VECTOR
+  if (crt_cpu_features() & CRT_CPU_AVX2) {
+    i = n & ~(size_t)7;
+    x0 = xor_avx2(a, i);
+  }
+#endif
+  for (; n - i >= 4; i += 4) {
+    x0 ^= a[i];
+    x1 ^= a[i + 1];
+    x2 ^= a[i + 2];
+    x3 ^= a[i + 3];
+  }
+  for (; i < n; ++i)
+    x0 ^= a[i];
+  return __paritydi2((di_int)(x0 ^ x1 ^ x2 ^ x3));
+}
@@ -0,0 +1,153 @@
+//===-- satdi3.c - Implement __ssadddi3 and friends -----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 64 bit saturating arithmetic for the compiler_rt
+// library: __ss*di on signed and __us*di on unsigned values, clamping
+// results that do not fit instead of wrapping. The _n and _1 forms apply
+// them over arrays.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+#define fixint_t di_int
+#define fixuint_t du_int
+#define COMPUTE_UMULHI(a, b) umulhidi((a), (b))
+#include "int_sat_impl.inc"
+
+// Returns: a + b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI di_int __ssadddi3(di_int a, di_int b) {
+  return __ssaddXi3(a, b);
+}
+
+// Returns: a - b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI di_int __sssubdi3(di_int a, di_int b) {
+  return __sssubXi3(a, b);
+}
+
+// Returns: a * b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI di_int __ssmuldi3(di_int a, di_int b) {
+  return __ssmulXi3(a, b);
+}
+
+// Returns: -a, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI di_int __ssnegdi2(di_int a) { return __ssnegXi2(a); }
+
+// Returns: a << b, clamped to [MIN, MAX]
+// Precondition:  0 <= b < 64
+
+COMPILER_RT_ABI di_int __ssashldi3(di_int a, int b) {
+  return __ssashlXi3(a, b);
+}
+
+// Returns: a + b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI du_int __usadddi3(du_int a, du_int b) {
+  return __usaddXi3(a, b);
+}
+
+// Returns: a - b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI du_int __ussubdi3(du_int a, du_int b) {
+  return __ussubXi3(a, b);
+}
+
+// Returns: a * b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI du_int __usmuldi3(du_int a, du_int b) {
+  return __usmulXi3(a, b);
+}
+
+// Returns: -a, clamped to [0, UMAX], which is always 0
+
+COMPILER_RT_ABI du_int __usnegdi2(du_int a) { return __usnegXi2(a); }
+
+// Returns: a << b, clamped to [0, UMAX]
+// Precondition:  0 <= b < 64
+
+COMPILER_RT_ABI du_int __usashldi3(du_int a, int b) {
+  return __usashlXi3(a, b);
+}
+
+// Effects: r[i] = __ssadddi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ssadddi3_n(di_int *r, const di_int *a, const di_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(di_int, __ssaddXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __sssubdi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __sssubdi3_n(di_int *r, const di_int *a, const di_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(di_int, __sssubXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ssmuldi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ssmuldi3_n(di_int *r, const di_int *a, const di_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(di_int, __ssmulXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ssnegdi2(a[i]) for i < n
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __ssnegdi2_n(di_int *r, const di_int *a, size_t n) {
+  SAT_ARRAY(di_int, __ssnegXi2, r, a, n);
+}
+
+// Effects: r[i] = __ssashldi3(a[i], b) for i < n
+// Precondition:  0 <= b < 64
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __ssashldi3_1(di_int *r, const di_int *a, int b,
+                                   size_t n) {
+  SAT_ARRAY_1(di_int, __ssashlXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usadddi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __usadddi3_n(du_int *r, const du_int *a, const du_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(du_int, __usaddXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ussubdi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ussubdi3_n(du_int *r, const du_int *a, const du_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(du_int, __ussubXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usmuldi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __usmuldi3_n(du_int *r, const du_int *a, const du_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(du_int, __usmulXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usashldi3(a[i], b) for i < n
+// Precondition:  0 <= b < 64
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __usashldi3_1(du_int *r, const du_int *a, int b,
+                                   size_t n) {
+  SAT_ARRAY_1(du_int, __usashlXi3, r, a, b, n);
+}
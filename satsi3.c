@@ -0,0 +1,152 @@
+//===-- satsi3.c - Implement __ssaddsi3 and friends -----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 32 bit saturating arithmetic for the compiler_rt
+// library: __ss*si on signed and __us*si on unsigned values, clamping
+// results that do not fit instead of wrapping. The _n and _1 forms apply
+// them over arrays.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#define fixint_t si_int
+#define fixuint_t su_int
+#define COMPUTE_UMULHI(a, b) ((su_int)(((du_int)(a) * (b)) >> 32))
+#include "int_sat_impl.inc"
+
+// Returns: a + b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI si_int __ssaddsi3(si_int a, si_int b) {
+  return __ssaddXi3(a, b);
+}
+
+// Returns: a - b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI si_int __sssubsi3(si_int a, si_int b) {
+  return __sssubXi3(a, b);
+}
+
+// Returns: a * b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI si_int __ssmulsi3(si_int a, si_int b) {
+  return __ssmulXi3(a, b);
+}
+
+// Returns: -a, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI si_int __ssnegsi2(si_int a) { return __ssnegXi2(a); }
+
+// Returns: a << b, clamped to [MIN, MAX]
+// Precondition:  0 <= b < 32
+
+COMPILER_RT_ABI si_int __ssashlsi3(si_int a, int b) {
+  return __ssashlXi3(a, b);
+}
+
+// Returns: a + b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI su_int __usaddsi3(su_int a, su_int b) {
+  return __usaddXi3(a, b);
+}
+
+// Returns: a - b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI su_int __ussubsi3(su_int a, su_int b) {
+  return __ussubXi3(a, b);
+}
+
+// Returns: a * b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI su_int __usmulsi3(su_int a, su_int b) {
+  return __usmulXi3(a, b);
+}
+
+// Returns: -a, clamped to [0, UMAX], which is always 0
+
+COMPILER_RT_ABI su_int __usnegsi2(su_int a) { return __usnegXi2(a); }
+
+// Returns: a << b, clamped to [0, UMAX]
+// Precondition:  0 <= b < 32
+
+COMPILER_RT_ABI su_int __usashlsi3(su_int a, int b) {
+  return __usashlXi3(a, b);
+}
+
+// Effects: r[i] = __ssaddsi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ssaddsi3_n(si_int *r, const si_int *a, const si_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(si_int, __ssaddXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __sssubsi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __sssubsi3_n(si_int *r, const si_int *a, const si_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(si_int, __sssubXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ssmulsi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ssmulsi3_n(si_int *r, const si_int *a, const si_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(si_int, __ssmulXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ssnegsi2(a[i]) for i < n
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __ssnegsi2_n(si_int *r, const si_int *a, size_t n) {
+  SAT_ARRAY(si_int, __ssnegXi2, r, a, n);
+}
+
+// Effects: r[i] = __ssashlsi3(a[i], b) for i < n
+// Precondition:  0 <= b < 32
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __ssashlsi3_1(si_int *r, const si_int *a, int b,
+                                   size_t n) {
+  SAT_ARRAY_1(si_int, __ssashlXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usaddsi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __usaddsi3_n(su_int *r, const su_int *a, const su_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(su_int, __usaddXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ussubsi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ussubsi3_n(su_int *r, const su_int *a, const su_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(su_int, __ussubXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usmulsi3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __usmulsi3_n(su_int *r, const su_int *a, const su_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(su_int, __usmulXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usashlsi3(a[i], b) for i < n
+// Precondition:  0 <= b < 32
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __usashlsi3_1(su_int *r, const su_int *a, int b,
+                                   size_t n) {
+  SAT_ARRAY_1(su_int, __usashlXi3, r, a, b, n);
+}
@@ -0,0 +1,158 @@
+//===-- satti3.c - Implement __ssaddti3 and friends -----------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements 128 bit saturating arithmetic for the compiler_rt
+// library: __ss*ti on signed and __us*ti on unsigned values, clamping
+// results that do not fit instead of wrapping. The _n and _1 forms apply
+// them over arrays.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+#include "int_udiv128.h"
+
+#define fixint_t ti_int
+#define fixuint_t tu_int
+#define COMPUTE_UMULHI(a, b) umulhiti((a), (b))
+#include "int_sat_impl.inc"
+
+// Returns: a + b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI ti_int __ssaddti3(ti_int a, ti_int b) {
+  return __ssaddXi3(a, b);
+}
+
+// Returns: a - b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI ti_int __sssubti3(ti_int a, ti_int b) {
+  return __sssubXi3(a, b);
+}
+
+// Returns: a * b, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI ti_int __ssmulti3(ti_int a, ti_int b) {
+  return __ssmulXi3(a, b);
+}
+
+// Returns: -a, clamped to [MIN, MAX]
+
+COMPILER_RT_ABI ti_int __ssnegti2(ti_int a) { return __ssnegXi2(a); }
+
+// Returns: a << b, clamped to [MIN, MAX]
+// Precondition:  0 <= b < 128
+
+COMPILER_RT_ABI ti_int __ssashlti3(ti_int a, int b) {
+  return __ssashlXi3(a, b);
+}
+
+// Returns: a + b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI tu_int __usaddti3(tu_int a, tu_int b) {
+  return __usaddXi3(a, b);
+}
+
+// Returns: a - b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI tu_int __ussubti3(tu_int a, tu_int b) {
+  return __ussubXi3(a, b);
+}
+
+// Returns: a * b, clamped to [0, UMAX]
+
+COMPILER_RT_ABI tu_int __usmulti3(tu_int a, tu_int b) {
+  return __usmulXi3(a, b);
+}
+
+// Returns: -a, clamped to [0, UMAX], which is always 0
+
+COMPILER_RT_ABI tu_int __usnegti2(tu_int a) { return __usnegXi2(a); }
+
+// Returns: a << b, clamped to [0, UMAX]
+// Precondition:  0 <= b < 128
+
+COMPILER_RT_ABI tu_int __usashlti3(tu_int a, int b) {
+  return __usashlXi3(a, b);
+}
+
+// Effects: r[i] = __ssaddti3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ssaddti3_n(ti_int *r, const ti_int *a, const ti_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(ti_int, __ssaddXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __sssubti3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __sssubti3_n(ti_int *r, const ti_int *a, const ti_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(ti_int, __sssubXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ssmulti3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ssmulti3_n(ti_int *r, const ti_int *a, const ti_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(ti_int, __ssmulXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ssnegti2(a[i]) for i < n
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __ssnegti2_n(ti_int *r, const ti_int *a, size_t n) {
+  SAT_ARRAY(ti_int, __ssnegXi2, r, a, n);
+}
+
+// Effects: r[i] = __ssashlti3(a[i], b) for i < n
+// Precondition:  0 <= b < 128
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __ssashlti3_1(ti_int *r, const ti_int *a, int b,
+                                   size_t n) {
+  SAT_ARRAY_1(ti_int, __ssashlXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usaddti3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __usaddti3_n(tu_int *r, const tu_int *a, const tu_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(tu_int, __usaddXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __ussubti3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __ussubti3_n(tu_int *r, const tu_int *a, const tu_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(tu_int, __ussubXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usmulti3(a[i], b[i]) for i < n
+// r may be the same array as a or b.
+
+COMPILER_RT_ABI void __usmulti3_n(tu_int *r, const tu_int *a, const tu_int *b,
+                                  size_t n) {
+  SAT_ARRAY_N(tu_int, __usmulXi3, r, a, b, n);
+}
+
+// Effects: r[i] = __usashlti3(a[i], b) for i < n
+// Precondition:  0 <= b < 128
+// r may be the same array as a.
+
+COMPILER_RT_ABI void __usashlti3_1(tu_int *r, const tu_int *a, int b,
+                                   size_t n) {
+  SAT_ARRAY_1(tu_int, __usashlXi3, r, a, b, n);
+}
+
+#endif // CRT_HAS_128BIT
@@ -0,0 +1,22 @@
+//===-- lib/sqrtdf2.c - Double-precision square root --------------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements double-precision soft-float square root
+// with the IEEE-754 default rounding (to nearest, ties to even).
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define DOUBLE_PRECISION
+
+#include "fp_sqrt_impl.inc"
+
+COMPILER_RT_ABI fp_t __sqrtdf2(fp_t a) { return __sqrtXf2__(a); }
+
+#endif
@@ -0,0 +1,31 @@
+//===-- lib/sqrttf2.c - Quad-precision square root ----------------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements quad-precision soft-float square root
+// with the IEEE-754 default rounding (to nearest, ties to even).
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define QUAD_PRECISION
+#include "fp_lib.h"
+
+#if defined(CRT_HAS_IEEE_TF)
+
+#if defined(CRT_HAS_TF_MODE)
+
+#include "fp_sqrt_impl.inc"
+
+COMPILER_RT_ABI fp_t __sqrttf2(fp_t a) { return __sqrtXf2__(a); }
+
+#endif
+
+#endif
+
+#endif
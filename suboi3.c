@@ -0,0 +1,32 @@
+//===-- suboi3.c - Implement __suboi3 -------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __suboi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_oi.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: a - b - borrow_in
+// Effects: if borrow_out != 0, *borrow_out = borrow out of the 256 bit
+// difference
+// borrow_in must be 0 or 1.
+
+COMPILER_RT_ABI ou_int __suboi3(ou_int a, ou_int b, su_int borrow_in,
+                                su_int *borrow_out) {
+  su_int borrow;
+  const ou_int r = ou_sub(a, b, borrow_in, &borrow);
+  if (borrow_out)
+    *borrow_out = borrow;
+  return r;
+}
+
+#endif // CRT_HAS_128BIT
@@ -0,0 +1,32 @@
+//===-- lib/truncdfsf2_round.c - double -> single, directed -------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements double to single conversion rounded toward zero,
+// downward and upward, whatever the current mode.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define SRC_DOUBLE
+#define DST_SINGLE
+#include "fp_trunc_impl.inc"
+
+COMPILER_RT_ABI dst_t __truncdfsf2_rz(src_t a) {
+  return __truncXfYf2_round__(a, CRT_FE_TOWARDZERO);
+}
+
+COMPILER_RT_ABI dst_t __truncdfsf2_rd(src_t a) {
+  return __truncXfYf2_round__(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI dst_t __truncdfsf2_ru(src_t a) {
+  return __truncXfYf2_round__(a, CRT_FE_UPWARD);
+}
+
+#endif
@@ -0,0 +1,38 @@
+//===-- lib/trunctfsf2_round.c - quad -> single, directed ---------*- C -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements quad to single conversion rounded toward zero,
+// downward and upward, whatever the current mode.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef CC_RUNTIME_NO_FLOAT
+
+#define QUAD_PRECISION
+#include "fp_lib.h"
+
+#if defined(CRT_HAS_TF_MODE)
+#define SRC_QUAD
+#define DST_SINGLE
+#include "fp_trunc_impl.inc"
+
+COMPILER_RT_ABI dst_t __trunctfsf2_rz(src_t a) {
+  return __truncXfYf2_round__(a, CRT_FE_TOWARDZERO);
+}
+
+COMPILER_RT_ABI dst_t __trunctfsf2_rd(src_t a) {
+  return __truncXfYf2_round__(a, CRT_FE_DOWNWARD);
+}
+
+COMPILER_RT_ABI dst_t __trunctfsf2_ru(src_t a) {
+  return __truncXfYf2_round__(a, CRT_FE_UPWARD);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,24 @@
+//===-- udivmoddi3.c - Implement __udivmoddi3 -----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __udivmoddi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+// Returns: { a / b, a % b }
+
+COMPILER_RT_ABI du_divmod __udivmoddi3(du_int a, du_int b) {
+  du_divmod result;
+  // On CPUs without 64 bit hardware division support,
+  //  this calls __udivdi3 once.
+  result.quot = a / b;
+  result.rem = a - result.quot * b;
+  return result;
+}
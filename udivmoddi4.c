@@ -24,6 +24,77 @@
 #pragma warning(disable : 4723 4724)
 #endif
 
+#if defined(__i386__)
+
+// Returns the 64 bit division result by 32 bit. Result must fit in 32 bits.
+// Remainder stored in r.
+static inline su_int udiv64by32to32(su_int u1, su_int u0, su_int v,
+                                    su_int *r) {
+  su_int result;
+  __asm__("divl %[v]"
+          : "=a"(result), "=d"(*r)
+          : [ v ] "r"(v), "a"(u0), "d"(u1));
+  return result;
+}
+
+// i386 has a 64-by-32 bit hardware divide, so every case takes at most two
+// divl instructions instead of falling into the shift-subtract loop below.
+COMPILER_RT_ABI du_int __udivmoddi4(du_int a, du_int b, du_int *rem) {
+  udwords n;
+  n.all = a;
+  udwords d;
+  d.all = b;
+  udwords q;
+  udwords r;
+  if (d.s.high == 0) {
+    if (n.s.high < d.s.low) {
+      // The result fits in 32 bits.
+      q.s.high = 0;
+    } else {
+      // First, divide with the high part to get the remainder in n.s.high.
+      // After that n.s.high < d.s.low.
+      q.s.high = udiv64by32to32(0, n.s.high, d.s.low, &n.s.high);
+    }
+    q.s.low = udiv64by32to32(n.s.high, n.s.low, d.s.low, &r.s.low);
+    r.s.high = 0;
+    if (rem)
+      *rem = r.all;
+    return q.all;
+  }
+  if (d.all > n.all) {
+    if (rem)
+      *rem = n.all;
+    return 0;
+  }
+  // The divisor has a non-zero high word, so the quotient fits in 32 bits.
+  // Estimate it with one divl by the top 32 bits of the normalized divisor;
+  // the dividend is halved first so that divl cannot overflow. The estimate
+  // is either the quotient or one too large, so decrement it and correct
+  // upwards at most once. See Hacker's Delight, 2nd edition, section 9-5.
+  // 0 <= shift <= 31.
+  const si_int shift = clzsi(d.s.high);
+  udwords normalized;
+  normalized.all = d.all << shift;
+  udwords halved;
+  halved.all = n.all >> 1;
+  su_int estimate_rem;
+  su_int quotient = udiv64by32to32(halved.s.high, halved.s.low,
+                                   normalized.s.high, &estimate_rem) >>
+                    (31 - shift);
+  if (quotient != 0)
+    --quotient;
+  r.all = n.all - (du_int)quotient * d.all;
+  if (r.all >= d.all) {
+    ++quotient;
+    r.all -= d.all;
+  }
+  if (rem)
+    *rem = r.all;
+  return quotient;
+}
+
+#else
+
 COMPILER_RT_ABI du_int __udivmoddi4(du_int a, du_int b, du_int *rem) {
   const unsigned n_uword_bits = sizeof(su_int) * CHAR_BIT;
   const unsigned n_udword_bits = sizeof(du_int) * CHAR_BIT;
@@ -195,6 +266,8 @@ COMPILER_RT_ABI du_int __udivmoddi4(du_int a, du_int b, du_int *rem) {
   return q.all;
 }
 
+#endif // defined(__i386__)
+
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(pop)
 #endif
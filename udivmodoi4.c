@@ -0,0 +1,149 @@
+//===-- udivmodoi4.c - Implement __udivmodoi4 -----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __udivmodoi4 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+#include "int_oi.h"
+#include "int_udiv128.h"
+
+// Effects: if rem != 0, *rem = a % b
+// Returns: a / b
+
+COMPILER_RT_ABI ou_int __udivmodoi4(ou_int a, ou_int b, ou_int *rem) {
+  const int bits_in_dword = (int)(sizeof(du_int) * CHAR_BIT);
+  ou_int quotient;
+  quotient.high = 0;
+  if (ou_cmp(a, b) == 0) {
+    quotient.low = 0;
+    if (rem)
+      *rem = a;
+    return quotient;
+  }
+  if (a.high == 0 || (b.high == 0 && b.low == 0)) {
+    // Both fit in 128 bits. A zero b takes this path too, so that division by
+    // zero behaves as it does in __udivmodti4 instead of running the limb
+    // loop below off the start of v.
+    tu_int r;
+    quotient.low = __udivmodti4(a.low, b.low, &r);
+    if (rem) {
+      rem->low = r;
+      rem->high = 0;
+    }
+    return quotient;
+  }
+  // Long division in 64 bit limbs, least significant first.
+  // See Knuth, Volume 2, section 4.3.1, Algorithm D.
+  du_int u[5] = {(du_int)a.low, (du_int)(a.low >> 64), (du_int)a.high,
+                 (du_int)(a.high >> 64), 0};
+  du_int v[4] = {(du_int)b.low, (du_int)(b.low >> 64), (du_int)b.high,
+                 (du_int)(b.high >> 64)};
+  du_int q[4] = {0, 0, 0, 0};
+  int n = 4; // Limbs in the divisor
+  while (v[n - 1] == 0)
+    --n;
+  int m = 4; // Limbs in the dividend, m >= n since a >= b
+  while (u[m - 1] == 0)
+    --m;
+  if (n == 1) {
+    // Short division; each step leaves a remainder below v[0].
+    du_int r = 0;
+    for (int i = m - 1; i >= 0; --i)
+      q[i] = udiv128by64to64(r, u[i], v[0], &r);
+    u[0] = r;
+    u[1] = u[2] = u[3] = 0;
+  } else {
+    // Normalize so that the top limb of the divisor has its high bit set,
+    // which bounds the error of each quotient estimate by 2.
+    const int s = __builtin_clzll(v[n - 1]);
+    if (s) {
+      for (int i = n - 1; i > 0; --i)
+        v[i] = (v[i] << s) | (v[i - 1] >> (bits_in_dword - s));
+      v[0] <<= s;
+      u[m] = u[m - 1] >> (bits_in_dword - s);
+      for (int i = m - 1; i > 0; --i)
+        u[i] = (u[i] << s) | (u[i - 1] >> (bits_in_dword - s));
+      u[0] <<= s;
+    }
+    for (int j = m - n; j >= 0; --j) {
+      // Estimate q[j] from the top two limbs of the partial remainder. The
+      // partial remainder is below v, so u[j + n] <= v[n - 1].
+      du_int qhat, rhat;
+      bool rhat_overflow = false;
+      if (u[j + n] == v[n - 1]) {
+        qhat = ~(du_int)0;
+        rhat = u[j + n - 1] + v[n - 1];
+        rhat_overflow = rhat < v[n - 1];
+      } else {
+        qhat = udiv128by64to64(u[j + n], u[j + n - 1], v[n - 1], &rhat);
+      }
+      // Refine the estimate with the second divisor limb; this takes at
+      // most two steps and leaves qhat at most one too large.
+      while (!rhat_overflow) {
+        du_int product_low;
+        const du_int product_high =
+            umul64x64to128(qhat, v[n - 2], &product_low);
+        if (product_high < rhat ||
+            (product_high == rhat && product_low <= u[j + n - 2]))
+          break;
+        --qhat;
+        rhat += v[n - 1];
+        rhat_overflow = rhat < v[n - 1];
+      }
+      // Multiply and subtract.
+      du_int carry = 0;
+      du_int borrow = 0;
+      for (int i = 0; i <= n; ++i) {
+        du_int product = carry;
+        if (i < n) {
+          const tu_int p = (tu_int)qhat * v[i] + carry;
+          product = (du_int)p;
+          carry = (du_int)(p >> 64);
+        }
+        const du_int t = u[i + j] - product;
+        const du_int borrow_t = u[i + j] < product;
+        u[i + j] = t - borrow;
+        borrow = borrow_t | (t < borrow);
+      }
+      if (borrow) {
+        // The estimate was one too large; add the divisor back.
+        --qhat;
+        du_int c = 0;
+        for (int i = 0; i < n; ++i) {
+          const tu_int sum = (tu_int)u[i + j] + v[i] + c;
+          u[i + j] = (du_int)sum;
+          c = (du_int)(sum >> 64);
+        }
+        u[j + n] += c;
+      }
+      q[j] = qhat;
+    }
+    // The remainder is in u[0..n-1]; undo the normalization.
+    if (s) {
+      for (int i = 0; i < n - 1; ++i)
+        u[i] = (u[i] >> s) | (u[i + 1] << (bits_in_dword - s));
+      u[n - 1] >>= s;
+    }
+    for (int i = n; i < 4; ++i)
+      u[i] = 0;
+  }
+  if (rem) {
+    rem->low = ((tu_int)u[1] << 64) | u[0];
+    rem->high = ((tu_int)u[3] << 64) | u[2];
+  }
+  quotient.low = ((tu_int)q[1] << 64) | q[0];
+  quotient.high = ((tu_int)q[3] << 64) | q[2];
+  return quotient;
+}
+
+#endif // CRT_HAS_128BIT
@@ -0,0 +1,24 @@
+//===-- udivmodsi3.c - Implement __udivmodsi3 -----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __udivmodsi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+// Returns: { a / b, a % b }
+
+COMPILER_RT_ABI su_divmod __udivmodsi3(su_int a, su_int b) {
+  su_divmod result;
+  // On CPUs without unsigned hardware division support,
+  //  this calls __udivsi3 once.
+  result.quot = a / b;
+  result.rem = a - result.quot * b;
+  return result;
+}
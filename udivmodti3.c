@@ -0,0 +1,25 @@
+//===-- udivmodti3.c - Implement __udivmodti3 -----------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __udivmodti3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: { a / b, a % b }
+
+COMPILER_RT_ABI tu_divmod __udivmodti3(tu_int a, tu_int b) {
+  tu_divmod result;
+  result.quot = __udivmodti4(a, b, &result.rem);
+  return result;
+}
+
+#endif // CRT_HAS_128BIT
@@ -12,12 +12,21 @@
 
 #include "int_lib.h"
 
+// Returns: a % b
+
+#if defined(__i386__)
+// __udivmoddi4 uses the hardware 64-by-32 bit divide on i386.
+COMPILER_RT_ABI du_int __umoddi3(du_int a, du_int b) {
+  du_int r;
+  __udivmoddi4(a, b, &r);
+  return r;
+}
+#else
 typedef du_int fixuint_t;
 typedef di_int fixint_t;
 #include "int_div_impl.inc"
 
-// Returns: a % b
-
 COMPILER_RT_ABI du_int __umoddi3(du_int a, du_int b) {
   return __umodXi3(a, b);
 }
+#endif
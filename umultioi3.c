@@ -0,0 +1,26 @@
+//===-- umultioi3.c - Implement __umultioi3 -------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements __umultioi3 for the compiler_rt library.
+//
+//===----------------------------------------------------------------------===//
+
+#include "int_lib.h"
+#include "int_udiv128.h"
+
+#ifdef CRT_HAS_128BIT
+
+// Returns: the full 256 bit product a * b
+
+COMPILER_RT_ABI ou_int __umultioi3(tu_int a, tu_int b) {
+  ou_int r;
+  r.high = umul128x128to256(a, b, &r.low);
+  return r;
+}
+
+#endif // CRT_HAS_128BIT